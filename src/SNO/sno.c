@@ -1,26 +1,153 @@
 #include "sno.h"
+#include "sno_inline.h"
+#include "sno_scan.h"
+#include "sno_stats.h"
 #include <string.h>
 
+#ifdef SNO_INLINE       /* define the out-of-line symbols, not the inline mappings */
+#undef sno_ch
+#undef sno_lit
+#undef sno_len
+#undef sno_any
+#undef sno_notany
+#undef sno_any_cset
+#undef sno_notany_cset
+#undef sno_tab
+#undef sno_rtab
+#undef sno_rem
+#undef sno_mark
+#endif
+
+#ifdef SNO_HOOKS
+/*
+ * Instrumented build (SNO_STATS, SNO_TRACE): each hooked primitive below is
+ * compiled as a static sno_<name>_body; the public sno_<name> at the end of
+ * the file wraps it with sno_stats_record. Calls between primitives in this file reach the bodies
+ * directly, so one user call is counted once.
+ */
+static bool sno_ch_body(sno_subject_t* s, char ch);
+static bool sno_lit_body(sno_subject_t* s, const char* lit);
+static bool sno_find_lit_body(sno_subject_t* s, const char* lit);
+static bool sno_ch_ci_body(sno_subject_t* s, char ch);
+static bool sno_lit_ci_body(sno_subject_t* s, const char* lit);
+static bool sno_oneof_body(sno_subject_t* s, const sno_lits_t* t, size_t* index);
+static bool sno_len_body(sno_subject_t* s, size_t n);
+static bool sno_any_body(sno_subject_t* s, const char* set);
+static bool sno_notany_body(sno_subject_t* s, const char* set);
+static bool sno_span_body(sno_subject_t* s, const char* set);
+static bool sno_break_body(sno_subject_t* s, const char* set);
+static bool sno_any_cset_body(sno_subject_t* s, const sno_cset_t* cs);
+static bool sno_notany_cset_body(sno_subject_t* s, const sno_cset_t* cs);
+static bool sno_span_cset_body(sno_subject_t* s, const sno_cset_t* cs);
+static bool sno_break_cset_body(sno_subject_t* s, const sno_cset_t* cs);
+static bool sno_rspan_body(sno_subject_t* s, const char* set);
+static bool sno_rbreak_body(sno_subject_t* s, const char* set);
+static bool sno_rspan_cset_body(sno_subject_t* s, const sno_cset_t* cs);
+static bool sno_rbreak_cset_body(sno_subject_t* s, const sno_cset_t* cs);
+static bool sno_rfind_lit_body(sno_subject_t* s, const char* lit);
+static bool sno_tab_body(sno_subject_t* s, size_t n);
+static bool sno_rtab_body(sno_subject_t* s, size_t n);
+static bool sno_rem_body(sno_subject_t* s);
+static bool sno_bal_body(sno_subject_t* s, char open, char close);
+static bool sno_bal_max_body(sno_subject_t* s, char open, char close, size_t max_depth);
+static bool sno_bal_set_body(sno_subject_t* s, const char* open, const char* close);
+static bool sno_bal_set_quoted_body(sno_subject_t* s, const char* open, const char* close, const char* quotes);
+
+#define sno_ch sno_ch_body
+#define sno_lit sno_lit_body
+#define sno_find_lit sno_find_lit_body
+#define sno_ch_ci sno_ch_ci_body
+#define sno_lit_ci sno_lit_ci_body
+#define sno_oneof sno_oneof_body
+#define sno_len sno_len_body
+#define sno_any sno_any_body
+#define sno_notany sno_notany_body
+#define sno_span sno_span_body
+#define sno_break sno_break_body
+#define sno_any_cset sno_any_cset_body
+#define sno_notany_cset sno_notany_cset_body
+#define sno_span_cset sno_span_cset_body
+#define sno_break_cset sno_break_cset_body
+#define sno_rspan sno_rspan_body
+#define sno_rbreak sno_rbreak_body
+#define sno_rspan_cset sno_rspan_cset_body
+#define sno_rbreak_cset sno_rbreak_cset_body
+#define sno_rfind_lit sno_rfind_lit_body
+#define sno_tab sno_tab_body
+#define sno_rtab sno_rtab_body
+#define sno_rem sno_rem_body
+#define sno_bal sno_bal_body
+#define sno_bal_max sno_bal_max_body
+#define sno_bal_set sno_bal_set_body
+#define sno_bal_set_quoted sno_bal_set_quoted_body
+#endif
+
 /* === Internal Helpers === */
 
 /* Roll back cursor and view to pos on failure; preserves failure contract (cursor unchanged) */
 #define sno_rollback(s, pos) ((s) ? ((s)->view.end = (pos), (s)->view.begin = (pos), false) : false)
 
+/* Membership in set string; '\0' is never a member (strchr would match the terminator) */
+#define sno_in(set, c) ((c) != '\0' && strchr((set), (c)) != NULL)
+
+/* ASCII case fold to lower; other bytes unchanged */
+#define sno_fold(c) ((unsigned char)((unsigned char)(c) - 'A') < 26 ? (unsigned char)((c) | 0x20) : (unsigned char)(c))
+
+/* Case-insensitive memcmp == 0 over n bytes */
+static bool sno_eq_ci(cstr_t* a, cstr_t* b, size_t n)
+{
+    while (n && sno_fold(*a) == sno_fold(*b)) {
+        a++;
+        b++;
+        n--;
+    }
+    return n == 0;
+}
+
+/* Empty every capture slot */
+static void sno_caps_clear(sno_subject_t* s)
+{
+    size_t i;
+    for (i = 0; i < SNO_CAPS; i++) s->caps[i].begin = s->caps[i].end = NULL;
+}
+
+/* Add every character of set to bitmap cs */
+static void sno_cset_add(sno_cset_t* cs, const char* set)
+{
+    while (*set) {
+        unsigned char c = (unsigned char)*set++;
+        cs->bits[c >> 3] |= (unsigned char)(1u << (c & 7));
+    }
+}
+
 /* === Subject Management === */
 
 void sno_bind(sno_subject_t* s, cstr_t* c)
+{
+    if (s && c) sno_bind_n(s, c, sno_scan_strlen(c));
+}
+
+void sno_bind_n(sno_subject_t* s, cstr_t* c, size_t len)
 {
     if (s && c) {
-        s->str.begin = s->str.end = s->view.begin = s->view.end = s->mark = c;
-        while (*s->str.end++ != '\0');
-        s->length = s->str.end - s->str.begin - 1;
+        s->str.begin = s->view.begin = s->view.end = s->mark = c;
+        s->str.end = c + len;                    /* bound, not terminator: O(1) bind */
+        s->length = len;
+        s->memo = NULL;                          /* new text: cached results no longer apply */
+        sno_caps_clear(s);
     }
 }
 
+void sno_bind_view(sno_subject_t* s, const sno_view_t* v)
+{
+    if (v) sno_bind_n(s, v->begin, v->end - v->begin);
+}
+
 bool sno_reset(sno_subject_t* s)
 {
     if (!s) return false;
     s->view.begin = s->view.end = s->mark = s->str.begin;
+    sno_caps_clear(s);
     return true;
 }
 
@@ -28,65 +155,141 @@ bool sno_reset(sno_subject_t* s)
 
 bool sno_ch(sno_subject_t* s, char ch)
 {
-    if (!s || *s->view.end != ch) return false;
+    return sno_ch_inline(s, ch);
+}
+
+bool sno_lit(sno_subject_t* s, const char* lit)
+{
+#if defined(SNO_SCAN_STRING_OPS)
+    if (!s || !lit) return false;
+    size_t len = sno_scan_strlen(lit);           /* REPNE SCASB, then REPE CMPSB */
+    cstr_t* pos = s->view.end;
+    if (len > (size_t)(s->str.end - pos) || !sno_scan_eq(pos, lit, len)) return false;
+    s->view.begin = pos;
+    s->view.end = pos + len;
+    return true;
+#else
+    return sno_lit_inline(s, lit);
+#endif
+}
+
+bool sno_ch_ci(sno_subject_t* s, char ch)
+{
+    if (!s || s->view.end == s->str.end || sno_fold(*s->view.end) != sno_fold(ch)) return false;
     s->view.begin = s->view.end++;
     return true;
 }
 
-bool sno_lit(sno_subject_t* s, const char* lit)
+bool sno_lit_ci(sno_subject_t* s, const char* lit)
 {
     if (!s || !lit) return false;
+    size_t len = strlen(lit);
     cstr_t* pos = s->view.end;
-    while (*lit && *pos == *lit) {
-        pos++;
-        lit++;
-    }
-    if (*lit) return false;
+    if (len > (size_t)(s->str.end - pos) || !sno_eq_ci(pos, lit, len)) return false;
+    s->view.begin = pos;
+    s->view.end = pos + len;
+    return true;
+}
+
+bool sno_find_lit(sno_subject_t* s, const char* lit)
+{
+    if (!s || !lit) return false;
+    cstr_t* hit = sno_scan_lit(s->view.end, s->str.end, lit, strlen(lit));
+    if (!hit) return false;                  /* no occurrence → cursor unchanged */
     s->view.begin = s->view.end;
-    s->view.end = pos;
+    s->view.end = hit;                       /* view = skipped span; cursor AT literal */
     return true;
 }
 
+/* === Keyword Tables === */
+
+/* Bucket key of a keyword's first byte: folded in case-insensitive tables */
+#define sno_lits_key(t, c) ((t)->ci ? sno_fold(c) : (unsigned char)(c))
+
+/* Table order: by first-byte key, then longest first (earlier word wins ties) */
+#define sno_lits_before(t, w, i, k) \
+    (sno_lits_key(t, (w)[i][0]) < sno_lits_key(t, (w)[k][0]) || \
+     (sno_lits_key(t, (w)[i][0]) == sno_lits_key(t, (w)[k][0]) && (t)->len[i] > (t)->len[k]))
+
+/* Shared by sno_lits and sno_lits_ci */
+static bool sno_lits_build(sno_lits_t* t, cstr_t* const* words, size_t n, bool ci)
+{
+    if (!t || !words || n > SNO_LITS_MAX) return false;
+    size_t i, j, c;
+    t->ci = ci;
+    for (i = 0; i < n; i++) {
+        size_t len = words[i] ? strlen(words[i]) : 0;
+        if (len == 0 || len > 255) return false;   /* empty or unindexable keyword */
+        t->len[i] = (unsigned char)len;
+        for (j = i; j > 0 && sno_lits_before(t, words, i, t->order[j - 1]); j--) {
+            t->order[j] = t->order[j - 1];         /* insertion sort: n ≤ SNO_LITS_MAX */
+        }
+        t->order[j] = (unsigned char)i;
+    }
+    for (c = 0, j = 0; c <= 256; c++) {            /* bucket bounds per first-byte key */
+        while (j < n && sno_lits_key(t, words[t->order[j]][0]) < c) j++;
+        t->first[c] = (unsigned char)j;
+    }
+    t->words = words;
+    t->count = n;
+    return true;
+}
+
+bool sno_lits(sno_lits_t* t, cstr_t* const* words, size_t n)
+{
+    return sno_lits_build(t, words, n, false);
+}
+
+bool sno_lits_ci(sno_lits_t* t, cstr_t* const* words, size_t n)
+{
+    return sno_lits_build(t, words, n, true);
+}
+
+bool sno_oneof(sno_subject_t* s, const sno_lits_t* t, size_t* index)
+{
+    if (!s || !t || s->view.end == s->str.end) return false;
+    cstr_t* pos = s->view.end;
+    size_t rem = s->str.end - pos;
+    unsigned char c = sno_lits_key(t, *pos);
+    size_t j;
+    for (j = t->first[c]; j < t->first[c + 1]; j++) {   /* only words starting with c, longest first */
+        size_t k = t->order[j];
+        size_t len = t->len[k];
+        if (len <= rem && (t->ci ? sno_eq_ci(pos + 1, t->words[k] + 1, len - 1)
+                                 : memcmp(pos + 1, t->words[k] + 1, len - 1) == 0)) {
+            if (index) *index = k;
+            s->view.begin = pos;
+            s->view.end = pos + len;
+            return true;
+        }
+    }
+    return false;
+}
+
 /* === Length === */
 
 bool sno_len(sno_subject_t* s, size_t n)
 {
-    if (!s) return false;
-    cstr_t* pos = s->view.end + n;
-    if (pos >= s->str.end) return false;  /* past end of string */
-    s->view.begin = s->view.end;
-    s->view.end = pos;
-    return true;
+    return sno_len_inline(s, n);
 }
 
 /* === Character Sets === */
 
 bool sno_any(sno_subject_t* s, const char* set)
 {
-    if (!s || !set) return false;
-    cstr_t* pos = s->view.end;
-    if (!*pos || !strchr(set, *pos)) return false;  /* not in set or at end */
-    s->view.begin = pos;
-    s->view.end = pos + 1;
-    return true;
+    return sno_any_inline(s, set);
 }
 
 bool sno_notany(sno_subject_t* s, const char* set)
 {
-    if (!s || !set) return false;
-    cstr_t* pos = s->view.end;
-    if (!*pos || strchr(set, *pos)) return false;  /* end of string OR char in set */
-    s->view.begin = pos;
-    s->view.end = pos + 1;
-    return true;
+    return sno_notany_inline(s, set);
 }
 
 bool sno_span(sno_subject_t* s, const char* set)
 {
     if (!s || !set) return false;
     cstr_t* start = s->view.end;
-    cstr_t* pos = start;
-    while (*pos && strchr(set, *pos)) pos++;
+    cstr_t* pos = sno_scan_set(start, s->str.end, set, true);
     if (pos == start) return false;  /* SPAN requires ≥1 char */
     s->view.begin = start;
     s->view.end = pos;
@@ -97,52 +300,136 @@ bool sno_break(sno_subject_t* s, const char* set)
 {
     if (!s || !set) return false;
     cstr_t* start = s->view.end;
-    cstr_t* pos = start;
-    while (*pos && !strchr(set, *pos)) pos++;
+    cstr_t* pos = sno_scan_set(start, s->str.end, set, false);
     /* BREAK succeeds even with zero-length match */
     s->view.begin = start;
     s->view.end = pos;
     return true;
 }
 
+/* === Character Set Bitmaps === */
+
+void sno_cset(sno_cset_t* cs, const char* set)
+{
+    if (!cs || !set) return;
+    memset(cs->bits, 0, sizeof(cs->bits));
+    sno_cset_add(cs, set);
+}
+
+void sno_cset_ci(sno_cset_t* cs, const char* set)
+{
+    size_t c;
+    if (!cs || !set) return;
+    sno_cset(cs, set);
+    for (c = 'a'; c <= 'z'; c++) {                 /* letter in either case: add both */
+        if (sno_cset_has(cs, c) || sno_cset_has(cs, c - 32)) {
+            cs->bits[c >> 3] |= (unsigned char)(1u << (c & 7));
+            cs->bits[(c - 32) >> 3] |= (unsigned char)(1u << ((c - 32) & 7));
+        }
+    }
+}
+
+bool sno_any_cset(sno_subject_t* s, const sno_cset_t* cs)
+{
+    return sno_any_cset_inline(s, cs);
+}
+
+bool sno_notany_cset(sno_subject_t* s, const sno_cset_t* cs)
+{
+    return sno_notany_cset_inline(s, cs);
+}
+
+bool sno_span_cset(sno_subject_t* s, const sno_cset_t* cs)
+{
+    if (!s || !cs) return false;
+    cstr_t* start = s->view.end;
+    cstr_t* pos = sno_scan_cset(start, s->str.end, cs, true);
+    if (pos == start) return false;  /* SPAN requires ≥1 char */
+    s->view.begin = start;
+    s->view.end = pos;
+    return true;
+}
+
+bool sno_break_cset(sno_subject_t* s, const sno_cset_t* cs)
+{
+    if (!s || !cs) return false;
+    cstr_t* start = s->view.end;
+    cstr_t* pos = sno_scan_cset(start, s->str.end, cs, false);
+    /* BREAK succeeds even with zero-length match */
+    s->view.begin = start;
+    s->view.end = pos;
+    return true;
+}
+
+/* === Reverse Scans === */
+
+/* Commit suffix piece [pos, end) found by a reverse scan; cursor moves to end */
+static bool sno_rtake(sno_subject_t* s, cstr_t* pos, cstr_t* end)
+{
+    s->view.begin = pos;
+    s->view.end = end;
+    return true;
+}
+
+bool sno_rspan(sno_subject_t* s, const char* set)
+{
+    if (!s || !set) return false;
+    cstr_t* pos = sno_scan_rset(s->view.end, s->str.end, set, true);
+    if (pos == s->str.end) return false;   /* RSPAN requires ≥1 char */
+    return sno_rtake(s, pos, s->str.end);
+}
+
+bool sno_rbreak(sno_subject_t* s, const char* set)
+{
+    if (!s || !set) return false;
+    return sno_rtake(s, sno_scan_rset(s->view.end, s->str.end, set, false), s->str.end);
+}
+
+bool sno_rspan_cset(sno_subject_t* s, const sno_cset_t* cs)
+{
+    if (!s || !cs) return false;
+    cstr_t* pos = sno_scan_rcset(s->view.end, s->str.end, cs, true);
+    if (pos == s->str.end) return false;
+    return sno_rtake(s, pos, s->str.end);
+}
+
+bool sno_rbreak_cset(sno_subject_t* s, const sno_cset_t* cs)
+{
+    if (!s || !cs) return false;
+    return sno_rtake(s, sno_scan_rcset(s->view.end, s->str.end, cs, false), s->str.end);
+}
+
+bool sno_rfind_lit(sno_subject_t* s, const char* lit)
+{
+    if (!s || !lit) return false;
+    size_t len = sno_scan_strlen(lit);
+    cstr_t* hit = sno_scan_rlit(s->view.end, s->str.end, lit, len);
+    if (!hit) return false;                  /* no occurrence → cursor unchanged */
+    return sno_rtake(s, hit, hit + len);
+}
+
 /* === Positioning === */
 
 bool sno_tab(sno_subject_t* s, size_t n)
 {
-    if (!s) return false;
-    size_t cur = s->view.end - s->str.begin;
-    if (n < cur || n > s->length) return false;  /* leftward move or beyond end → fail */
-    s->view.begin = s->view.end;
-    s->view.end = s->str.begin + n;
-    return true;
+    return sno_tab_inline(s, n);
 }
 
 bool sno_rtab(sno_subject_t* s, size_t n)
 {
-    if (!s || n > s->length) return false;       /* n > length would position before start */
-    size_t cur = s->view.end - s->str.begin;
-    size_t target = s->length - n;
-    if (target < cur) return false;              /* leftward move → fail */
-    s->view.begin = s->view.end;
-    s->view.end = s->str.begin + target;
-    return true;
+    return sno_rtab_inline(s, n);
 }
 
 bool sno_rem(sno_subject_t* s)
 {
-    if (!s) return false;
-    s->view.begin = s->view.end;
-    s->view.end = s->str.end - 1;                /* before null terminator */
-    return true;
+    return sno_rem_inline(s);
 }
 
 /* === Capture === */
 
 bool sno_mark(sno_subject_t* s)
 {
-    if (!s) return false;
-    s->mark = s->view.end;
-    return true;
+    return sno_mark_inline(s);
 }
 
 bool sno_cap(sno_subject_t* s, char* buf, size_t buflen)
@@ -165,27 +452,345 @@ bool sno_var(sno_subject_t* s, char* buf, size_t buflen)
     return true;
 }
 
+sno_view_t sno_cap_view(sno_subject_t* s)
+{
+    sno_view_t v = {NULL, NULL};
+    if (s && s->mark) {
+        v.begin = s->mark;
+        v.end = s->view.end;
+    }
+    return v;
+}
+
+/* === Capture Slots === */
+
+bool sno_mark_n(sno_subject_t* s, size_t i)
+{
+    if (!s || i >= SNO_CAPS) return false;
+    s->caps[i].begin = s->caps[i].end = s->view.end;
+    return true;
+}
+
+bool sno_cap_n(sno_subject_t* s, size_t i)
+{
+    if (!s || i >= SNO_CAPS || !s->caps[i].begin) return false;   /* slot never marked */
+    s->caps[i].end = s->view.end;
+    return true;
+}
+
+sno_view_t sno_cap_view_n(sno_subject_t* s, size_t i)
+{
+    sno_view_t v = {NULL, NULL};
+    if (s && i < SNO_CAPS) v = s->caps[i];
+    return v;
+}
+
+bool sno_rollback_n(sno_subject_t* s, cstr_t* pos)
+{
+    size_t i;
+    if (!s || !pos) return false;
+    for (i = 0; i < SNO_CAPS; i++) {     /* drop slots marked or closed after pos */
+        if (s->caps[i].begin && (s->caps[i].begin > pos || s->caps[i].end > pos)) {
+            s->caps[i].begin = s->caps[i].end = NULL;
+        }
+    }
+    return sno_rollback(s, pos);
+}
+
 /* === Balanced Delimiters === */
 
 bool sno_bal(sno_subject_t* s, char open, char close)
+{
+    return sno_bal_max(s, open, close, (size_t)-1);
+}
+
+bool sno_bal_max(sno_subject_t* s, char open, char close, size_t max_depth)
 {
     if (!s) return false;
 
     cstr_t* start = s->view.end;
+    cstr_t* pos = start;
     char delim[3] = {open, close, '\0'};
+    size_t depth = 1;
+
+    if (pos == s->str.end || *pos != open || !max_depth) return false;   /* Match opening delimiter */
+    pos++;
+
+    while (depth) {                         /* Single pass: depth counter replaces recursion */
+        pos = sno_scan_set(pos, s->str.end, delim, false);   /* skip interior to next delimiter */
+        if (pos == s->str.end) return false;                 /* EOF before close: cursor untouched */
+        if (*pos == close) depth--;                          /* close first: open == close pairs quotes */
+        else if (++depth > max_depth) return false;          /* adversarial nesting: fail fast */
+        pos++;
+    }
+
+    s->view.begin = start; /* Success: view spans entire balanced expression INCLUDING delimiters */
+    s->view.end = pos;
+    return true;
+}
+
+bool sno_bal_set(sno_subject_t* s, const char* open, const char* close)
+{
+    return sno_bal_set_quoted(s, open, close, NULL);
+}
+
+bool sno_bal_set_quoted(sno_subject_t* s, const char* open, const char* close, const char* quotes)
+{
+    if (!s || !open || !close || strlen(open) != strlen(close)) return false;
+
+    cstr_t* start = s->view.end;
+    cstr_t* pos = start;
+    cstr_t* end = s->str.end;
+    unsigned char stack[SNO_BAL_DEPTH];      /* index into close[] of each pending opener */
+    size_t depth = 0;
+    sno_cset_t cs;                           /* structural characters: openers, closers, quotes */
+
+    if (pos == end || !sno_in(open, *pos)) return false;   /* Match opening delimiter */
+    stack[depth++] = (unsigned char)(strchr(open, *pos++) - open);
 
-    if (!sno_ch(s, open)) return false;     /* Match opening delimiter */
+    sno_cset(&cs, open);
+    sno_cset_add(&cs, close);
+    if (quotes) sno_cset_add(&cs, quotes);
 
-    while (*s->view.end && *s->view.end != close) {    /* Consume balanced interior */
-        if (*s->view.end == open) {
-            if (!sno_bal(s, open, close)) return sno_rollback(s, start);
+    while (depth) {                          /* Single pass over interior */
+        pos = sno_scan_cset(pos, end, &cs, false);
+        if (pos == end) return false;        /* EOF before close: cursor untouched */
+        char c = *pos;
+        if (c == close[stack[depth - 1]]) {
+            depth--;                         /* expected closer pops */
+        } else if (quotes && sno_in(quotes, c)) {
+            for (pos++; pos < end && *pos != c; pos++) {
+                if (*pos == '\\' && pos + 1 < end) pos++;   /* backslash escapes next char */
+            }
+            if (pos == end) return false;    /* unterminated quote */
+        } else if (sno_in(open, c)) {
+            if (depth == SNO_BAL_DEPTH) return false;       /* delimiter stack full */
+            stack[depth++] = (unsigned char)(strchr(open, c) - open);
         } else {
-            if (!sno_notany(s, delim)) return sno_rollback(s, start);
+            return false;                    /* closer that does not match innermost opener */
         }
+        pos++;
     }
 
-    if (!sno_ch(s, close)) return sno_rollback(s, start);    /* Match closing delimiter */
-
     s->view.begin = start; /* Success: view spans entire balanced expression INCLUDING delimiters */
+    s->view.end = pos;
     return true;
 }
+
+/* === Instrumented Entry Points === */
+
+#ifdef SNO_HOOKS
+#undef sno_ch
+#undef sno_lit
+#undef sno_find_lit
+#undef sno_ch_ci
+#undef sno_lit_ci
+#undef sno_oneof
+#undef sno_len
+#undef sno_any
+#undef sno_notany
+#undef sno_span
+#undef sno_break
+#undef sno_any_cset
+#undef sno_notany_cset
+#undef sno_span_cset
+#undef sno_break_cset
+#undef sno_rspan
+#undef sno_rbreak
+#undef sno_rspan_cset
+#undef sno_rbreak_cset
+#undef sno_rfind_lit
+#undef sno_tab
+#undef sno_rtab
+#undef sno_rem
+#undef sno_bal
+#undef sno_bal_max
+#undef sno_bal_set
+#undef sno_bal_set_quoted
+
+/* Count one call of body around cursor movement */
+#define sno_stat_call(id, s, body) do {             \
+        cstr_t* at_ = (s) ? (s)->view.end : NULL;   \
+        bool ok_ = (body);                          \
+        sno_stats_record((id), (s), at_, ok_, NULL); \
+        return ok_;                                 \
+    } while (0)
+
+/* As sno_stat_call, with the bytes read measured from at_ by probe after the call */
+#define sno_stat_call_probe(id, s, body, probe) do { \
+        cstr_t* at_ = (s) ? (s)->view.end : NULL;   \
+        bool ok_ = (body);                          \
+        sno_stats_record((id), (s), at_, ok_, at_ ? at_ + (probe) : NULL); \
+        return ok_;                                 \
+    } while (0)
+
+/* Bytes a compare of lit[0..len) at pos reads: through the first mismatch; none if lit overruns */
+static size_t sno_probe_eq(cstr_t* pos, size_t rem, const char* lit, size_t len, bool ci, bool* eq)
+{
+    size_t i = 0;
+    *eq = false;
+    if (!lit || len > rem) return 0;             /* length check fails before any compare */
+    while (i < len && (ci ? sno_fold(pos[i]) == sno_fold(lit[i]) : pos[i] == lit[i])) i++;
+    *eq = i == len;
+    return i < len ? i + 1 : len;
+}
+
+static size_t sno_probe_lit(const sno_subject_t* s, cstr_t* at, const char* lit, bool ci)
+{
+    bool eq;
+    return sno_probe_eq(at, (size_t)(s->str.end - at), lit, lit ? strlen(lit) : 0, ci, &eq);
+}
+
+/* Longest probe sno_oneof made: first byte, then each candidate up to the one that matched */
+static size_t sno_probe_oneof(const sno_subject_t* s, cstr_t* at, const sno_lits_t* t)
+{
+    size_t rem = (size_t)(s->str.end - at), best, j;
+    unsigned char c;
+    if (!t || !rem) return 0;
+    best = 1;
+    c = sno_lits_key(t, *at);
+    for (j = t->first[c]; j < t->first[c + 1]; j++) {
+        size_t k = t->order[j], len = t->len[k], n;
+        bool eq;
+        n = len > rem ? 0 : 1 + sno_probe_eq(at + 1, rem - 1, t->words[k] + 1, len - 1, t->ci, &eq);
+        if (n > best) best = n;
+        if (len <= rem && eq) break;
+    }
+    return best;
+}
+
+bool sno_ch(sno_subject_t* s, char ch)
+{
+    sno_stat_call(SNO_STAT_CH, s, sno_ch_body(s, ch));
+}
+
+bool sno_lit(sno_subject_t* s, const char* lit)
+{
+    sno_stat_call_probe(SNO_STAT_LIT, s, sno_lit_body(s, lit), sno_probe_lit(s, at_, lit, false));
+}
+
+bool sno_find_lit(sno_subject_t* s, const char* lit)
+{
+    sno_stat_call(SNO_STAT_FIND_LIT, s, sno_find_lit_body(s, lit));
+}
+
+bool sno_ch_ci(sno_subject_t* s, char ch)
+{
+    sno_stat_call(SNO_STAT_CH_CI, s, sno_ch_ci_body(s, ch));
+}
+
+bool sno_lit_ci(sno_subject_t* s, const char* lit)
+{
+    sno_stat_call_probe(SNO_STAT_LIT_CI, s, sno_lit_ci_body(s, lit), sno_probe_lit(s, at_, lit, true));
+}
+
+bool sno_oneof(sno_subject_t* s, const sno_lits_t* t, size_t* index)
+{
+    sno_stat_call_probe(SNO_STAT_ONEOF, s, sno_oneof_body(s, t, index), sno_probe_oneof(s, at_, t));
+}
+
+bool sno_len(sno_subject_t* s, size_t n)
+{
+    sno_stat_call(SNO_STAT_LEN, s, sno_len_body(s, n));
+}
+
+bool sno_any(sno_subject_t* s, const char* set)
+{
+    sno_stat_call(SNO_STAT_ANY, s, sno_any_body(s, set));
+}
+
+bool sno_notany(sno_subject_t* s, const char* set)
+{
+    sno_stat_call(SNO_STAT_NOTANY, s, sno_notany_body(s, set));
+}
+
+bool sno_span(sno_subject_t* s, const char* set)
+{
+    sno_stat_call(SNO_STAT_SPAN, s, sno_span_body(s, set));
+}
+
+bool sno_break(sno_subject_t* s, const char* set)
+{
+    sno_stat_call(SNO_STAT_BREAK, s, sno_break_body(s, set));
+}
+
+bool sno_any_cset(sno_subject_t* s, const sno_cset_t* cs)
+{
+    sno_stat_call(SNO_STAT_ANY_CSET, s, sno_any_cset_body(s, cs));
+}
+
+bool sno_notany_cset(sno_subject_t* s, const sno_cset_t* cs)
+{
+    sno_stat_call(SNO_STAT_NOTANY_CSET, s, sno_notany_cset_body(s, cs));
+}
+
+bool sno_span_cset(sno_subject_t* s, const sno_cset_t* cs)
+{
+    sno_stat_call(SNO_STAT_SPAN_CSET, s, sno_span_cset_body(s, cs));
+}
+
+bool sno_break_cset(sno_subject_t* s, const sno_cset_t* cs)
+{
+    sno_stat_call(SNO_STAT_BREAK_CSET, s, sno_break_cset_body(s, cs));
+}
+
+bool sno_rspan(sno_subject_t* s, const char* set)
+{
+    sno_stat_call(SNO_STAT_RSPAN, s, sno_rspan_body(s, set));
+}
+
+bool sno_rbreak(sno_subject_t* s, const char* set)
+{
+    sno_stat_call(SNO_STAT_RBREAK, s, sno_rbreak_body(s, set));
+}
+
+bool sno_rspan_cset(sno_subject_t* s, const sno_cset_t* cs)
+{
+    sno_stat_call(SNO_STAT_RSPAN_CSET, s, sno_rspan_cset_body(s, cs));
+}
+
+bool sno_rbreak_cset(sno_subject_t* s, const sno_cset_t* cs)
+{
+    sno_stat_call(SNO_STAT_RBREAK_CSET, s, sno_rbreak_cset_body(s, cs));
+}
+
+bool sno_rfind_lit(sno_subject_t* s, const char* lit)
+{
+    sno_stat_call(SNO_STAT_RFIND_LIT, s, sno_rfind_lit_body(s, lit));
+}
+
+bool sno_tab(sno_subject_t* s, size_t n)
+{
+    sno_stat_call(SNO_STAT_TAB, s, sno_tab_body(s, n));
+}
+
+bool sno_rtab(sno_subject_t* s, size_t n)
+{
+    sno_stat_call(SNO_STAT_RTAB, s, sno_rtab_body(s, n));
+}
+
+bool sno_rem(sno_subject_t* s)
+{
+    sno_stat_call(SNO_STAT_REM, s, sno_rem_body(s));
+}
+
+bool sno_bal(sno_subject_t* s, char open, char close)
+{
+    sno_stat_call(SNO_STAT_BAL, s, sno_bal_body(s, open, close));
+}
+
+bool sno_bal_max(sno_subject_t* s, char open, char close, size_t max_depth)
+{
+    sno_stat_call(SNO_STAT_BAL_MAX, s, sno_bal_max_body(s, open, close, max_depth));
+}
+
+bool sno_bal_set(sno_subject_t* s, const char* open, const char* close)
+{
+    sno_stat_call(SNO_STAT_BAL_SET, s, sno_bal_set_body(s, open, close));
+}
+
+bool sno_bal_set_quoted(sno_subject_t* s, const char* open, const char* close, const char* quotes)
+{
+    sno_stat_call(SNO_STAT_BAL_SET_QUOTED, s, sno_bal_set_quoted_body(s, open, close, quotes));
+}
+#endif
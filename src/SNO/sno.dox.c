@@ -25,7 +25,8 @@
  *
  * @section model Core Model
  *
- * - <b>Subject</b>: Immutable null-terminated string (sno_bind)
+ * - <b>Subject</b>: Immutable null-terminated string (sno_bind) or bounded
+ *   (pointer, length) slice (sno_bind_n)—primitives stop at str.end, never at '\0'
  * - <b>Cursor</b>: Current position = s->view.end
  * - <b>Pattern</b>: Function that advances cursor on success, leaves unchanged on failure
  * - <b>View</b>: Half-open span [begin,end) capturing matched substring
@@ -69,6 +70,11 @@
 /** Immutable character type alias for const-correct string handling */
 typedef const char cstr_t;
 
+/** Number of capture slots per subject (define before including sno.h to resize) */
+#ifndef SNO_CAPS
+#define SNO_CAPS 4
+#endif
+
 /**
  * @brief Half-open string slice [begin, end)
  *
@@ -87,13 +93,50 @@ typedef struct {
  * Maintains subject string state and current match position.
  * All pattern primitives advance s->view.end on success; leave unchanged on failure.
  */
+struct sno_memo_s;  /* Packrat memo table (sno_memo.h) */
+
 typedef struct {
-    sno_view_t str;    /**< Full subject string [begin, end) including null terminator */
+    sno_view_t str;    /**< Full subject string [begin, end); end is the bound, not the terminator */
     sno_view_t view;   /**< Current match span [begin, end); cursor = view.end */
     cstr_t* mark;      /**< Capture start position */
-    size_t length;     /**< Cached strlen (excluding null terminator) */
+    size_t length;     /**< Cached subject length (str.end - str.begin) */
+    sno_view_t caps[SNO_CAPS];  /**< Capture slots [mark_n, cap_n); {NULL, NULL} when unset */
+    struct sno_memo_s* memo;    /**< Attached memo table (sno_memo_attach); NULL = memoization off */
 } sno_subject_t;
 
+/**
+ * @brief Precompiled 256-bit character set (one bit per byte value)
+ *
+ * Built once from a set string by sno_cset(), or taken ready-made from the
+ * SNO_CSET_* constants in sno_constants.h. Membership is a single bit test,
+ * so the _cset primitives cost O(1) per subject character regardless of set size.
+ */
+typedef struct {
+    unsigned char bits[32];  /**< Bit (c & 7) of bits[c >> 3] set iff c is a member */
+} sno_cset_t;
+
+/** Maximum keywords per sno_lits_t table (≤ 255; define before including sno.h to resize) */
+#ifndef SNO_LITS_MAX
+#define SNO_LITS_MAX 64
+#endif
+
+/**
+ * @brief Prebuilt keyword dispatch table for sno_oneof
+ *
+ * Words are bucketed by first byte and ordered longest first, so matching
+ * one of N literals examines only the candidates sharing the cursor's byte
+ * instead of rescanning with a chain of sno_lit || sno_lit || ...
+ * Built in place from a caller word list (sno_lits); no allocation.
+ */
+typedef struct {
+    cstr_t* const* words;                /**< Caller's word list (not copied; must outlive table) */
+    size_t count;                        /**< Number of words */
+    bool ci;                             /**< Case-insensitive table (sno_lits_ci); buckets by folded byte */
+    unsigned char first[257];            /**< order[first[c] .. first[c+1]) start with byte c */
+    unsigned char order[SNO_LITS_MAX];   /**< Word indices by first byte, longest first */
+    unsigned char len[SNO_LITS_MAX];     /**< Cached word lengths */
+} sno_lits_t;
+
 /** @name Subject Management */
 /** @{ */
 
@@ -107,6 +150,31 @@ typedef struct {
  */
 void sno_bind(sno_subject_t* s, cstr_t* c);
 
+/**
+ * @brief Bind bounded subject (pointer, length) to parsing context
+ *
+ * O(1) bind—no terminator scan. The subject is [c, c + len); matching never
+ * reads beyond the bound, so slices of larger buffers, network packets and
+ * file maps parse in place. Embedded '\0' bytes are ordinary characters.
+ * @param s Parsing context (must not be NULL)
+ * @param c Start of immutable subject bytes (must not be NULL)
+ * @param len Number of bytes in subject
+ * @note After binding: s->view = [c, c), cursor at start, capture slots empty,
+ *       no memo table attached
+ */
+void sno_bind_n(sno_subject_t* s, cstr_t* c, size_t len);
+
+/**
+ * @brief Bind a view (typically a parent's s.view) as a bounded child subject
+ *
+ * Zero-copy nested parsing: the child subject is exactly [v->begin, v->end),
+ * so sno_tab, sno_rtab, sno_rem and sno_at/sno_at_r work relative to the view.
+ * The parent is not modified; both may be used independently afterwards.
+ * @param s Child parsing context (must not be NULL)
+ * @param v View to bind, e.g. &parent.view (must not be NULL)
+ */
+void sno_bind_view(sno_subject_t* s, const sno_view_t* v);
+
 /**
  * @brief Reset cursor and mark to start of subject string
  *
@@ -144,6 +212,74 @@ bool sno_ch(sno_subject_t* s, char ch);
  */
 bool sno_lit(sno_subject_t* s, const char* lit);
 
+/**
+ * @brief Skip to next occurrence of literal (BREAK for a string)
+ *
+ * Searches [cursor, str.end) for 'lit' (memchr for short inputs, Horspool for
+ * long ones). On success the cursor stops AT the occurrence—follow with sno_lit
+ * to consume it—and s->view spans the skipped text.
+ * @param s Parsing context (must not be NULL)
+ * @param lit Null-terminated string to find (must not be NULL)
+ * @return true if found (empty lit matches at cursor); false otherwise (cursor unchanged on failure)
+ * @note Replaces the per-byte idiom: while (!sno_lit(s, lit) && sno_len(s, 1));
+ */
+bool sno_find_lit(sno_subject_t* s, const char* lit);
+
+/**
+ * @brief Match single character ignoring ASCII case
+ *
+ * Folds both sides inline ('A'-'Z' ≡ 'a'-'z'); the subject is never copied
+ * or lowercased. Other bytes compare exactly.
+ * @param s Parsing context (must not be NULL)
+ * @param ch Character to match in either case
+ * @return true if matched; false otherwise (cursor unchanged on failure)
+ */
+bool sno_ch_ci(sno_subject_t* s, char ch);
+
+/**
+ * @brief Match literal string ignoring ASCII case
+ *
+ * For HTTP header names, DOS filenames and other case-insensitive tokens.
+ * @param s Parsing context (must not be NULL)
+ * @param lit Null-terminated string to match in any case mix (must not be NULL)
+ * @return true if matched; false otherwise (cursor unchanged on failure)
+ */
+bool sno_lit_ci(sno_subject_t* s, const char* lit);
+
+/** @} */
+
+/** @name Keyword Tables */
+/** @{ */
+
+/**
+ * @brief Build keyword table from word list
+ * @param t Table to initialize (must not be NULL)
+ * @param words Array of n null-terminated keywords (must outlive t)
+ * @param n Number of keywords (≤ SNO_LITS_MAX)
+ * @return true if built; false on NULL args, n too large, or an empty/over-255-char word
+ */
+bool sno_lits(sno_lits_t* t, cstr_t* const* words, size_t n);
+
+/**
+ * @brief Build case-insensitive keyword table from word list
+ *
+ * As sno_lits, but sno_oneof then matches words in any ASCII case mix.
+ * @return true if built; false on NULL args, n too large, or an empty/over-255-char word
+ */
+bool sno_lits_ci(sno_lits_t* t, cstr_t* const* words, size_t n);
+
+/**
+ * @brief Match the longest keyword from table at cursor
+ *
+ * One dispatch on the cursor byte, then candidates longest first—"GETALL" wins
+ * over "GET" when both match.
+ * @param s Parsing context (must not be NULL)
+ * @param t Table built by sno_lits or sno_lits_ci (must not be NULL)
+ * @param index Receives index of matched word in the original list (may be NULL)
+ * @return true if a keyword matched (cursor advanced past it); false otherwise (cursor unchanged)
+ */
+bool sno_oneof(sno_subject_t* s, const sno_lits_t* t, size_t* index);
+
 /** @} */
 
 /** @name Length */
@@ -152,11 +288,11 @@ bool sno_lit(sno_subject_t* s, const char* lit);
 /**
  * @brief Match exactly n characters from cursor
  *
- * Succeeds iff n characters remain before null terminator.
+ * Succeeds iff n characters remain before end of subject (str.end).
  * @param s Parsing context (must not be NULL)
  * @param n Exact number of characters to consume
  * @return true if match succeeds; false otherwise (cursor unchanged on failure)
- * @note Fails if n == 0 or cursor + n >= str.end
+ * @note Fails if cursor + n > str.end
  */
 bool sno_len(sno_subject_t* s, size_t n);
 
@@ -213,6 +349,142 @@ bool sno_break(sno_subject_t* s, const char* set);
 
 /** @} */
 
+/** @name Character Set Bitmaps */
+/** @{ */
+
+/**
+ * @brief Build character set bitmap from set string
+ *
+ * Clears cs, then sets one bit per character of 'set'. Build once, match many times.
+ * @param cs Bitmap to initialize (must not be NULL)
+ * @param set Null-terminated string of member characters (must not be NULL)
+ * @note No-op if either argument is NULL
+ */
+void sno_cset(sno_cset_t* cs, const char* set);
+
+/**
+ * @brief Build case-folded character set bitmap
+ *
+ * As sno_cset, then every ASCII letter present in either case is added in
+ * both, so the _cset primitives match case-insensitively at full speed.
+ * @param cs Bitmap to initialize (must not be NULL)
+ * @param set Null-terminated string of member characters (must not be NULL)
+ */
+void sno_cset_ci(sno_cset_t* cs, const char* set);
+
+/**
+ * @brief Match single character from bitmap set (sno_any with O(1) membership)
+ * @param s Parsing context (must not be NULL)
+ * @param cs Precompiled set (must not be NULL)
+ * @return true if character matched; false otherwise (cursor unchanged on failure)
+ * @see sno_any
+ */
+bool sno_any_cset(sno_subject_t* s, const sno_cset_t* cs);
+
+/**
+ * @brief Match single character NOT in bitmap set (sno_notany with O(1) membership)
+ * @param s Parsing context (must not be NULL)
+ * @param cs Precompiled set (must not be NULL)
+ * @return true if character matched; false otherwise (cursor unchanged on failure)
+ * @see sno_notany
+ */
+bool sno_notany_cset(sno_subject_t* s, const sno_cset_t* cs);
+
+/**
+ * @brief Match 1+ characters from bitmap set (sno_span with O(1) membership)
+ * @param s Parsing context (must not be NULL)
+ * @param cs Precompiled set (must not be NULL)
+ * @return true if ≥1 character matched; false otherwise (cursor unchanged on failure)
+ * @see sno_span
+ */
+bool sno_span_cset(sno_subject_t* s, const sno_cset_t* cs);
+
+/**
+ * @brief Match 0+ characters until bitmap set member (sno_break with O(1) membership)
+ * @param s Parsing context (must not be NULL)
+ * @param cs Precompiled set (must not be NULL)
+ * @return true always (even for zero-length match); false only on NULL args
+ * @see sno_break
+ */
+bool sno_break_cset(sno_subject_t* s, const sno_cset_t* cs);
+
+/**
+ * @brief Test membership of character c in bitmap set cs
+ * @return nonzero if c is a member; 0 otherwise
+ */
+#define sno_cset_has(cs, c) (((cs)->bits[(unsigned char)(c) >> 3] >> ((unsigned char)(c) & 7)) & 1)
+
+/** @} */
+
+/** @name Reverse Scans */
+/** @{ */
+
+/*
+ * Reverse primitives scan from str.end back toward the cursor and never read
+ * bytes before it, so suffix work (extensions, trailing checksums, the last
+ * path component) costs the suffix, not the subject. Each one matches a
+ * piece at the end and moves the cursor forward to that piece's end; the
+ * bytes between the old cursor and the piece are skipped, as sno_tab skips
+ * them.
+ *
+ * The scan is always anchored at str.end. sno_rtab(s, n) moves the cursor,
+ * so it only limits the scan to the last n bytes; it does not move the
+ * anchor. To scan backward from the rtab point instead, rebind the bytes
+ * before it, which sno_rtab leaves in the view:
+ *
+ *     sno_rtab(&s, 3); head = s.view; sno_bind_view(&s, &head); sno_rbreak(&s, "/");
+ *
+ * On "dir/name.ext;v2" that gives "name.ext" where sno_rbreak alone after
+ * sno_rtab(&s, 3) gives "v2".
+ */
+
+/**
+ * @brief Match the trailing run of set members (reverse SPAN)
+ *
+ * "file.tar.gz" with set "gz" → view "gz", cursor at end.
+ * @param s Parsing context (must not be NULL)
+ * @param set Null-terminated string of member characters (must not be NULL)
+ * @return true if ≥1 trailing member matched; false otherwise (cursor unchanged on failure)
+ */
+bool sno_rspan(sno_subject_t* s, const char* set);
+
+/**
+ * @brief Match the trailing run without set members (reverse BREAK)
+ *
+ * View = bytes after the last member (the whole rest of the subject when
+ * there is none), cursor at end. "src/sno/sno.c" with "/" → view "sno.c".
+ * @param s Parsing context (must not be NULL)
+ * @param set Null-terminated string of stop characters (must not be NULL)
+ * @return true always (even for zero-length match); false only on NULL args
+ */
+bool sno_rbreak(sno_subject_t* s, const char* set);
+
+/**
+ * @brief sno_rspan with O(1) bitmap membership
+ * @see sno_rspan
+ */
+bool sno_rspan_cset(sno_subject_t* s, const sno_cset_t* cs);
+
+/**
+ * @brief sno_rbreak with O(1) bitmap membership
+ * @see sno_rbreak
+ */
+bool sno_rbreak_cset(sno_subject_t* s, const sno_cset_t* cs);
+
+/**
+ * @brief Match the last occurrence of a literal after the cursor
+ *
+ * View = the occurrence, cursor just after it, so sno_rem then yields the
+ * tail: "a.b.c" with "." → view ".", sno_rem → "c". Fails when lit does
+ * not occur, which sno_rbreak cannot report.
+ * @param s Parsing context (must not be NULL)
+ * @param lit Null-terminated literal (must not be NULL)
+ * @return true if found; false otherwise (cursor unchanged on failure)
+ */
+bool sno_rfind_lit(sno_subject_t* s, cstr_t* lit);
+
+/** @} */
+
 /** @name Positioning */
 /** @{ */
 
@@ -287,6 +559,64 @@ bool sno_cap(sno_subject_t* s, char* buf, size_t buflen);
  */
 bool sno_var(sno_subject_t* s, char* buf, size_t buflen);
 
+/**
+ * @brief Return span between mark and cursor as a view (zero-copy sno_cap)
+ *
+ * No buffer, no copy, cannot overflow. Compare, hash or forward the bytes
+ * directly, or convert with the sno_view_* helpers in sno_str.h.
+ * @param s Parsing context
+ * @return View [mark, cursor); empty {NULL, NULL} if s is NULL or unbound
+ * @note Does not modify cursor or mark. Valid while the subject string is.
+ */
+sno_view_t sno_cap_view(sno_subject_t* s);
+
+/** @} */
+
+/** @name Capture Slots */
+/** @{ */
+
+/**
+ * @brief Open capture slot i at current cursor
+ *
+ * Like sno_mark, but for one of SNO_CAPS independent slots, so a whole record
+ * pattern can run to completion and hand back N views with no intermediate copies.
+ * Slots are cleared by sno_bind/sno_reset.
+ * @param s Parsing context (must not be NULL)
+ * @param i Slot index (< SNO_CAPS)
+ * @return true on success; false if s is NULL or i out of range
+ */
+bool sno_mark_n(sno_subject_t* s, size_t i);
+
+/**
+ * @brief Close capture slot i at current cursor
+ *
+ * Slot i becomes the view [cursor at sno_mark_n, cursor now).
+ * @param s Parsing context (must not be NULL)
+ * @param i Slot index (< SNO_CAPS)
+ * @return true on success; false if i out of range or slot never opened
+ */
+bool sno_cap_n(sno_subject_t* s, size_t i);
+
+/**
+ * @brief Return view held by capture slot i
+ * @param s Parsing context
+ * @param i Slot index (< SNO_CAPS)
+ * @return Slot view; {NULL, NULL} if unset, out of range or s is NULL
+ */
+sno_view_t sno_cap_view_n(sno_subject_t* s, size_t i);
+
+/**
+ * @brief Roll back cursor to pos and drop capture slots touched after pos
+ *
+ * The failure path for a group of primitives that set slots: slots opened or
+ * closed beyond pos are cleared, earlier slots are kept (including a slot
+ * still open exactly at pos), and the cursor returns to pos with an empty view.
+ * @param s Parsing context (must not be NULL)
+ * @param pos Cursor saved before the group (s->view.end)
+ * @return false always—use as: return sno_rollback_n(s, start);
+ */
+bool sno_rollback_n(sno_subject_t* s, cstr_t* pos);
+
 /** @} */
 
 /** @name Balanced Delimiters */
@@ -296,7 +626,8 @@ bool sno_var(sno_subject_t* s, char* buf, size_t buflen);
  * @brief Match balanced delimiters (SNOBOL BAL primitive generalized)
  *
  * Matches a nonnull string balanced with respect to delimiter pair (open, close).
- * Validates nesting deterministically through explicit recursion—no backtracking.
+ * Validates nesting in a single linear pass with a depth counter—no recursion,
+ * no backtracking, constant stack regardless of nesting depth.
  * The matched span includes outer delimiters (e.g., "(A)" not "A").
  *
  * @param s Parsing context (must not be NULL)
@@ -310,6 +641,53 @@ bool sno_var(sno_subject_t* s, char* buf, size_t buflen);
  */
 bool sno_bal(sno_subject_t* s, char open, char close);
 
+/**
+ * @brief Match balanced delimiters with bounded nesting depth
+ *
+ * Same contract as sno_bal, but fails as soon as nesting exceeds max_depth,
+ * so adversarial input like "((((...))))" cannot stall a parser.
+ * @param s Parsing context (must not be NULL)
+ * @param open Opening delimiter character
+ * @param close Closing delimiter character
+ * @param max_depth Maximum nesting level (1 = no nested pairs; 0 always fails)
+ * @return true if balanced expression matched within max_depth; false otherwise (cursor unchanged)
+ * @see sno_bal
+ */
+bool sno_bal_max(sno_subject_t* s, char open, char close, size_t max_depth);
+
+/**
+ * @brief Match balanced expression over several delimiter pairs at once
+ *
+ * open[i] pairs with close[i], e.g. sno_bal_set(s, "([{", ")]}"). Tracks correct
+ * interleaving with a fixed SNO_BAL_DEPTH-entry delimiter stack in one linear pass—
+ * "{a:[(1)]}" matches, "[(])" fails. Must start at an opener; the view includes
+ * the outer delimiters.
+ * @param s Parsing context (must not be NULL)
+ * @param open Opening delimiters (must not be NULL)
+ * @param close Matching closing delimiters, same length as open (must not be NULL)
+ * @return true if balanced expression matched; false otherwise (cursor unchanged)
+ * @note Fails if nesting exceeds SNO_BAL_DEPTH (define before including sno.h to resize)
+ */
+bool sno_bal_set(sno_subject_t* s, const char* open, const char* close);
+
+/**
+ * @brief sno_bal_set that skips quoted strings
+ *
+ * Any character of 'quotes' opens a quoted run that ends at the same character;
+ * delimiters inside are ignored and a backslash escapes the next character.
+ * @param s Parsing context (must not be NULL)
+ * @param open Opening delimiters (must not be NULL)
+ * @param close Matching closing delimiters (must not be NULL)
+ * @param quotes Quote characters, e.g. "\"'" (NULL behaves as sno_bal_set)
+ * @return true if balanced expression matched; false on imbalance or unterminated quote (cursor unchanged)
+ */
+bool sno_bal_set_quoted(sno_subject_t* s, const char* open, const char* close, const char* quotes);
+
+/** Delimiter stack size for sno_bal_set (maximum nesting) */
+#ifndef SNO_BAL_DEPTH
+#define SNO_BAL_DEPTH 32
+#endif
+
 /** @} */
 
 /** @name Position Predicates */
@@ -325,7 +703,10 @@ bool sno_bal(sno_subject_t* s, char open, char close);
  * @return true if cursor at offset n; false otherwise or if s is NULL
  * @note Use for post-match validation: if (pattern && sno_at(s, 10)) { ... }
  */
-#define sno_at(s, n) ((s) && (size_t)((s)->view.end - (s)->str.begin) == (n))
+static inline bool sno_at(const sno_subject_t* s, size_t n)
+{
+    return s && (size_t)(s->view.end - s->str.begin) == n;
+}
 
 /**
  * @brief Test if cursor is at offset (length - n) from right end
@@ -337,7 +718,42 @@ bool sno_bal(sno_subject_t* s, char open, char close);
  * @return true if cursor at (length - n); false otherwise or if s is NULL
  * @note sno_at_r(s, 0) tests "cursor at end of string"
  */
-#define sno_at_r(s, n) ((s) && (size_t)((s)->view.end - (s)->str.begin) == (s)->length - (n))
+static inline bool sno_at_r(const sno_subject_t* s, size_t n)
+{
+    return s && (size_t)(s->str.end - s->view.end) == n;
+}
+
+/** @} */
+
+/** @name Inline Build Mode */
+/** @{ */
+
+/**
+ * @brief Define SNO_INLINE (before including sno.h) to inline single-step primitives
+ *
+ * Maps sno_ch, sno_lit, sno_len, sno_any, sno_notany, sno_any_cset,
+ * sno_notany_cset, sno_tab, sno_rtab, sno_rem and sno_mark to the static
+ * inline definitions in sno_inline.h, removing a far call per primitive in
+ * && / || chains under the large memory model. Behaviour is unchanged and
+ * the out-of-line functions remain available, e.g. through (sno_ch)(s, c).
+ * sno_inline.h also provides unchecked _u variants (sno_ch_u, ...) that skip
+ * NULL guards for callers that guarantee valid arguments.
+ * Ignored under SNO_STATS and SNO_TRACE, whose hooks must see every call.
+ */
+#if defined(SNO_INLINE) && !defined(SNO_STATS) && !defined(SNO_TRACE)   /* hooks see every call */
+#include "sno_inline.h"
+#define sno_ch(s, ch) sno_ch_inline((s), (ch))
+#define sno_lit(s, c) sno_lit_inline((s), (c))
+#define sno_len(s, n) sno_len_inline((s), (n))
+#define sno_any(s, set) sno_any_inline((s), (set))
+#define sno_notany(s, set) sno_notany_inline((s), (set))
+#define sno_any_cset(s, cs) sno_any_cset_inline((s), (cs))
+#define sno_notany_cset(s, cs) sno_notany_cset_inline((s), (cs))
+#define sno_tab(s, n) sno_tab_inline((s), (n))
+#define sno_rtab(s, n) sno_rtab_inline((s), (n))
+#define sno_rem(s) sno_rem_inline((s))
+#define sno_mark(s) sno_mark_inline((s))
+#endif
 
 /** @} */
 
@@ -6,25 +6,60 @@
 
 typedef const char cstr_t;
 
+#ifndef SNO_CAPS
+#define SNO_CAPS 4
+#endif
+
 typedef struct {
     cstr_t* begin;
     cstr_t* end;
 } sno_view_t;
 
+struct sno_memo_s;
+
 typedef struct {
     sno_view_t str;
     sno_view_t view;
     cstr_t* mark;
     size_t length;
+    sno_view_t caps[SNO_CAPS];
+    struct sno_memo_s* memo;
 } sno_subject_t;
 
+typedef struct {
+    unsigned char bits[32];
+} sno_cset_t;
+
+#ifndef SNO_LITS_MAX
+#define SNO_LITS_MAX 64
+#endif
+
+typedef struct {
+    cstr_t* const* words;
+    size_t count;
+    bool ci;
+    unsigned char first[257];
+    unsigned char order[SNO_LITS_MAX];
+    unsigned char len[SNO_LITS_MAX];
+} sno_lits_t;
+
 /* === Subject Management === */
 void sno_bind(sno_subject_t* s, cstr_t* c);
+void sno_bind_n(sno_subject_t* s, cstr_t* c, size_t len);
+void sno_bind_view(sno_subject_t* s, const sno_view_t* v);
 bool sno_reset(sno_subject_t* s);
 
 /* === Literals === */
 bool sno_ch(sno_subject_t* s, char ch);
 bool sno_lit(sno_subject_t* s, cstr_t* c);
+bool sno_find_lit(sno_subject_t* s, cstr_t* lit);
+bool sno_ch_ci(sno_subject_t* s, char ch);
+bool sno_lit_ci(sno_subject_t* s, cstr_t* lit);
+
+/* === Keyword Tables === */
+bool sno_lits(sno_lits_t* t, cstr_t* const* words, size_t n);
+bool sno_lits_ci(sno_lits_t* t, cstr_t* const* words, size_t n);
+bool sno_oneof(sno_subject_t* s, const sno_lits_t* t, size_t* index);
 
 /* === Length === */
 bool sno_len(sno_subject_t* s, size_t n);
@@ -35,6 +70,24 @@ bool sno_notany(sno_subject_t* s, const char* set);
 bool sno_span(sno_subject_t* s, const char* set);
 bool sno_break(sno_subject_t* s, const char* set);
 
+/* === Character Set Bitmaps === */
+void sno_cset(sno_cset_t* cs, const char* set);
+void sno_cset_ci(sno_cset_t* cs, const char* set);
+bool sno_any_cset(sno_subject_t* s, const sno_cset_t* cs);
+bool sno_notany_cset(sno_subject_t* s, const sno_cset_t* cs);
+bool sno_span_cset(sno_subject_t* s, const sno_cset_t* cs);
+bool sno_break_cset(sno_subject_t* s, const sno_cset_t* cs);
+
+#define sno_cset_has(cs, c) (((cs)->bits[(unsigned char)(c) >> 3] >> ((unsigned char)(c) & 7)) & 1)
+
+/* === Reverse Scans === */
+/* Anchored at str.end; the cursor (e.g. after sno_rtab) is the lower bound only */
+bool sno_rspan(sno_subject_t* s, const char* set);
+bool sno_rbreak(sno_subject_t* s, const char* set);
+bool sno_rspan_cset(sno_subject_t* s, const sno_cset_t* cs);
+bool sno_rbreak_cset(sno_subject_t* s, const sno_cset_t* cs);
+bool sno_rfind_lit(sno_subject_t* s, cstr_t* lit);
+
 /* === Positioning === */
 bool sno_tab(sno_subject_t* s, size_t n);
 bool sno_rtab(sno_subject_t* s, size_t n);
@@ -44,12 +97,50 @@ bool sno_rem(sno_subject_t* s);
 bool sno_mark(sno_subject_t* s);
 bool sno_cap(sno_subject_t* s, char* buf, size_t buflen);
 bool sno_var(sno_subject_t* s, char* buf, size_t buflen);
+sno_view_t sno_cap_view(sno_subject_t* s);
+
+/* === Capture Slots === */
+bool sno_mark_n(sno_subject_t* s, size_t i);
+bool sno_cap_n(sno_subject_t* s, size_t i);
+sno_view_t sno_cap_view_n(sno_subject_t* s, size_t i);
+bool sno_rollback_n(sno_subject_t* s, cstr_t* pos);
 
 /* === Balanced Delimiters === */
 bool sno_bal(sno_subject_t* s, char open, char close);
+bool sno_bal_max(sno_subject_t* s, char open, char close, size_t max_depth);
+bool sno_bal_set(sno_subject_t* s, const char* open, const char* close);
+bool sno_bal_set_quoted(sno_subject_t* s, const char* open, const char* close, const char* quotes);
+
+#ifndef SNO_BAL_DEPTH
+#define SNO_BAL_DEPTH 32
+#endif
 
 /* === Position Predicates === */
-#define sno_at(s, n) ((s) && (size_t)((s)->view.end - (s)->str.begin) == (n))
-#define sno_at_r(s, n) ((s) && (size_t)((s)->view.end - (s)->str.begin) == (s)->length - (n))
+/* Functions, not macros: a NULL test on &s in a macro trips -Waddress */
+static inline bool sno_at(const sno_subject_t* s, size_t n)
+{
+    return s && (size_t)(s->view.end - s->str.begin) == n;
+}
+
+static inline bool sno_at_r(const sno_subject_t* s, size_t n)
+{
+    return s && (size_t)(s->str.end - s->view.end) == n;
+}
+
+/* === Inline Build Mode (sno_inline.h) === */
+#if defined(SNO_INLINE) && !defined(SNO_STATS) && !defined(SNO_TRACE)   /* hooks see every call */
+#include "sno_inline.h"
+#define sno_ch(s, ch) sno_ch_inline((s), (ch))
+#define sno_lit(s, c) sno_lit_inline((s), (c))
+#define sno_len(s, n) sno_len_inline((s), (n))
+#define sno_any(s, set) sno_any_inline((s), (set))
+#define sno_notany(s, set) sno_notany_inline((s), (set))
+#define sno_any_cset(s, cs) sno_any_cset_inline((s), (cs))
+#define sno_notany_cset(s, cs) sno_notany_cset_inline((s), (cs))
+#define sno_tab(s, n) sno_tab_inline((s), (n))
+#define sno_rtab(s, n) sno_rtab_inline((s), (n))
+#define sno_rem(s) sno_rem_inline((s))
+#define sno_mark(s) sno_mark_inline((s))
+#endif
 
 #endif
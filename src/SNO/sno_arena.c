@@ -0,0 +1,57 @@
+#include "sno_arena.h"
+#include <string.h>
+
+/* === Arena Management === */
+
+void sno_arena(sno_arena_t* a, void* mem, size_t size)
+{
+    if (!a) return;
+    a->base = (char*)mem;
+    a->size = mem ? size : 0;
+    a->used = 0;
+}
+
+void sno_arena_reset(sno_arena_t* a)
+{
+    if (a) a->used = 0;
+}
+
+void* sno_arena_alloc(sno_arena_t* a, size_t n)
+{
+    size_t at;
+    if (!a) return NULL;
+    at = (a->used + SNO_ARENA_ALIGN - 1) / SNO_ARENA_ALIGN * SNO_ARENA_ALIGN;
+    if (at > a->size || n > a->size - at) return NULL;
+    a->used = at + n;
+    return a->base + at;
+}
+
+/* === Copies === */
+
+char* sno_arena_view(sno_arena_t* a, sno_view_t v)
+{
+    size_t len;
+    char* p;
+    if (!a || !v.begin || v.end < v.begin) return NULL;
+    len = (size_t)(v.end - v.begin);
+    if (len >= a->size - a->used) return NULL;   /* no room for '\0' */
+    p = a->base + a->used;                       /* strings need no alignment */
+    memcpy(p, v.begin, len);
+    p[len] = '\0';
+    a->used += len + 1;
+    return p;
+}
+
+char* sno_cap_arena(sno_subject_t* s, sno_arena_t* a)
+{
+    sno_view_t v;
+    if (!s || !s->mark) return NULL;
+    v.begin = s->mark;
+    v.end = s->view.end;
+    return sno_arena_view(a, v);
+}
+
+char* sno_var_arena(sno_subject_t* s, sno_arena_t* a)
+{
+    return s ? sno_arena_view(a, s->view) : NULL;
+}
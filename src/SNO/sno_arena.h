@@ -0,0 +1,55 @@
+/* sno_arena.h — Bump allocator for captures and parse results */
+
+#ifndef SNO_ARENA_H
+#define SNO_ARENA_H
+
+#include "sno.h"
+
+/**
+ * @file sno_arena.h
+ * @brief One caller-provided block per record: O(1) allocation and reset
+ *
+ * Replaces a fixed char buf[N] per field: sno_cap_arena / sno_var_arena copy
+ * exactly len + 1 bytes and return the NUL-terminated copy, so small fields
+ * waste nothing and large ones fit as long as the record does. No per-field
+ * malloc, no fragmentation—on the DOS large model the block can be a single
+ * far allocation reused for every record.
+ *
+ * Allocation failure returns NULL and leaves the arena unchanged, so the
+ * copy functions compose with && like any primitive.
+ *
+ * @code
+ * sno_arena_reset(&a);                         // per record
+ * if (sno_mark(&s) && sno_span(&s, SNO_ALNUM_U) && (key = sno_cap_arena(&s, &a)) != NULL) ...
+ * @endcode
+ */
+
+#ifndef SNO_ARENA_ALIGN
+#define SNO_ARENA_ALIGN sizeof(void*)   /* Alignment of sno_arena_alloc results */
+#endif
+
+typedef struct {
+    char* base;    /**< Block start (caller-owned, aligned to SNO_ARENA_ALIGN) */
+    size_t size;   /**< Block capacity */
+    size_t used;   /**< Bytes allocated */
+} sno_arena_t;
+
+/** Initialize arena over mem[0..size) */
+void sno_arena(sno_arena_t* a, void* mem, size_t size);
+
+/** Free everything (O(1)) */
+void sno_arena_reset(sno_arena_t* a);
+
+/** Allocate n bytes aligned to SNO_ARENA_ALIGN; NULL when full */
+void* sno_arena_alloc(sno_arena_t* a, size_t n);
+
+/** Copy view into arena as NUL-terminated string; NULL when full */
+char* sno_arena_view(sno_arena_t* a, sno_view_t v);
+
+/** sno_cap into arena: copy [mark, cursor) */
+char* sno_cap_arena(sno_subject_t* s, sno_arena_t* a);
+
+/** sno_var into arena: copy current view */
+char* sno_var_arena(sno_subject_t* s, sno_arena_t* a);
+
+#endif
@@ -0,0 +1,51 @@
+#include "sno_arena_test.h"
+#include "sno_constants.h"
+#include <assert.h>
+#include <string.h>
+
+void sno_arena_test(void) {
+    static void* mem[8];                                         /* 32/64 bytes, pointer-aligned */
+    sno_subject_t s = {0};
+    sno_arena_t a;
+    char* key;
+    char* val;
+    void* p;
+    size_t used;
+
+    /* Exactly len + 1 bytes per capture */
+    sno_arena(&a, mem, sizeof(mem));
+    sno_bind(&s, "host=alpha");
+    assert(sno_mark(&s) && sno_span(&s, SNO_ALNUM_U) && (key = sno_cap_arena(&s, &a)) != NULL);
+    assert(strcmp(key, "host") == 0 && a.used == 5);
+    assert(sno_ch(&s, '=') && sno_rem(&s) && (val = sno_var_arena(&s, &a)) != NULL);
+    assert(strcmp(val, "alpha") == 0 && val == key + 5 && a.used == 11);
+    assert(strcmp(key, "host") == 0);                            /* earlier copy intact */
+
+    /* Aligned allocation */
+    p = sno_arena_alloc(&a, 3);
+    assert(p && (size_t)((char*)p - a.base) % SNO_ARENA_ALIGN == 0 && (char*)p >= val + 6);
+
+    /* Full: NULL, arena unchanged */
+    used = a.used;
+    sno_bind(&s, "0123456789012345678901234567890123456789012345678901234567890123456789");
+    assert(sno_rem(&s) && sno_var_arena(&s, &a) == NULL && a.used == used);
+    assert(sno_arena_alloc(&a, sizeof(mem)) == NULL && a.used == used);
+
+    /* O(1) reset reuses the block */
+    sno_arena_reset(&a);
+    assert(a.used == 0);
+    sno_bind(&s, "abc");
+    assert(sno_len(&s, 2) && (key = sno_var_arena(&s, &a)) == a.base && strcmp(key, "ab") == 0);
+    assert(sno_arena_view(&a, s.str) && a.used == 7);
+
+    /* Empty capture, last byte fits exactly */
+    sno_arena(&a, mem, 4);
+    sno_bind(&s, "xyz");
+    assert(sno_mark(&s) && (key = sno_cap_arena(&s, &a)) != NULL && key[0] == '\0');
+    assert(sno_rem(&s) && sno_var_arena(&s, &a) == NULL);        /* 3 + 1 > 3 remaining */
+    sno_bind(&s, "xy");
+    assert(sno_rem(&s) && sno_var_arena(&s, &a) != NULL && a.used == 4);
+
+    /* NULL guards */
+    assert(!sno_cap_arena(NULL, &a) && !sno_var_arena(&s, NULL) && !sno_arena_alloc(NULL, 1));
+}
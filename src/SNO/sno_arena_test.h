@@ -0,0 +1,9 @@
+#ifndef SNO_ARENA_TEST_H
+#define SNO_ARENA_TEST_H
+
+#include "sno_arena.h"
+#include <stdio.h>
+
+void sno_arena_test();
+
+#endif
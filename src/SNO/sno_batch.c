@@ -0,0 +1,97 @@
+#include "sno_batch.h"
+#include "sno_lines.h"
+#include "sno_scan.h"
+#include <string.h>
+
+/* === Internal Helpers === */
+
+#if defined(__GNUC__)
+#define sno_prefetch(p) __builtin_prefetch((p), 0, 0)
+#else
+#define sno_prefetch(p) ((void)0)
+#endif
+
+/* Prefetch line i + SNO_BATCH_AHEAD */
+#define sno_batch_ahead(b, i) \
+    ((i) + SNO_BATCH_AHEAD < (b)->n ? sno_prefetch((b)->ptr[(i) + SNO_BATCH_AHEAD]) : (void)0)
+
+#define sno_batch_set(hits, i) ((hits)[(i) >> 3] |= (unsigned char)(1u << ((i) & 7)))
+
+static void sno_batch_clear(const sno_batch_t* b, unsigned char* hits)
+{
+    memset(hits, 0, (b->n + 7) / 8);
+}
+
+/* === Batch Management === */
+
+void sno_batch(sno_batch_t* b, cstr_t** ptr, size_t* len, size_t max)
+{
+    if (!b) return;
+    b->ptr = ptr;
+    b->len = len;
+    b->n = 0;
+    b->max = ptr && len ? max : 0;
+}
+
+bool sno_batch_add(sno_batch_t* b, cstr_t* p, size_t n)
+{
+    if (!b || !p || b->n == b->max) return false;
+    b->ptr[b->n] = p;
+    b->len[b->n] = n;
+    b->n++;
+    return true;
+}
+
+size_t sno_batch_records(sno_batch_t* b, cstr_t* buf, size_t len, char delim)
+{
+    sno_subject_t s = {0}, rec = {0};
+    sno_lines_t it;
+    if (!b || !buf) return 0;
+    sno_bind_n(&s, buf, len);
+    sno_records(&it, &s, delim);
+    while (b->n < b->max && sno_lines_next(&it, &rec)) {
+        sno_batch_add(b, rec.str.begin, rec.length);
+    }
+    return (size_t)(it.pos - buf);
+}
+
+/* === Batch Matching === */
+
+size_t sno_match_batch(const sno_batch_t* b, sno_record_fn fn, void* ctx, unsigned char* hits)
+{
+    sno_subject_t s = {0};
+    size_t i, count = 0;
+    if (!b || !fn || !hits) return 0;
+    sno_batch_clear(b, hits);
+    for (i = 0; i < b->n; i++) {
+        sno_batch_ahead(b, i);
+        sno_bind_n(&s, b->ptr[i], b->len[i]);
+        if (fn(&s, ctx)) {
+            sno_batch_set(hits, i);
+            count++;
+        }
+    }
+    return count;
+}
+
+size_t sno_match_batch_pat(const sno_batch_t* b, const sno_pat_t* p, unsigned char* hits)
+{
+    sno_subject_t s = {0};
+    sno_view_t lit;
+    size_t i, m = 0, count = 0;
+    if (!b || !p || !p->ok || !hits) return 0;
+    sno_batch_clear(b, hits);
+    if (sno_pat_anchor(p, &lit)) m = (size_t)(lit.end - lit.begin);
+    for (i = 0; i < b->n; i++) {
+        cstr_t* line = b->ptr[i];
+        sno_batch_ahead(b, i);
+        if (m && b->len[i] >= SNO_BATCH_PREFILTER && !sno_scan_lit(line, line + b->len[i], lit.begin, m))
+            continue;                                   /* anchor absent: skip matcher */
+        sno_bind_n(&s, line, b->len[i]);
+        if (sno_match(&s, p)) {
+            sno_batch_set(hits, i);
+            count++;
+        }
+    }
+    return count;
+}
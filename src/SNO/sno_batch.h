@@ -0,0 +1,64 @@
+/* sno_batch.h — Match one pattern against many short subjects */
+
+#ifndef SNO_BATCH_H
+#define SNO_BATCH_H
+
+#include "sno.h"
+#include "sno_parallel.h"
+#include "sno_pat.h"
+
+/**
+ * @file sno_batch.h
+ * @brief Apply one pattern across a batch of lines with one subject and no per-line setup
+ *
+ * A batch is structure-of-arrays: parallel arrays of line starts and lengths,
+ * so the driver streams through two dense arrays instead of a subject per
+ * line. One subject is rebound per line (O(1), no strlen), and the line a
+ * few entries ahead is prefetched while the current one is matched.
+ *
+ * Results go to a caller bitmap, bit i (hits[i >> 3] & (1 << (i & 7))) set
+ * when line i matched; it needs (n + 7) / 8 bytes.
+ *
+ * For compiled patterns the pattern's anchor literal (sno_pat_anchor) is
+ * searched for first with the vector literal scan in lines of at least
+ * SNO_BATCH_PREFILTER bytes, and lines without it are rejected before the
+ * matcher runs. Short lines fail faster in the matcher itself.
+ */
+
+#ifndef SNO_BATCH_PREFILTER
+#define SNO_BATCH_PREFILTER 64   /* Shorter lines go straight to the matcher */
+#endif
+
+#ifndef SNO_BATCH_AHEAD
+#define SNO_BATCH_AHEAD 4   /* Lines prefetched ahead of the one being matched */
+#endif
+
+typedef struct {
+    cstr_t** ptr;     /**< ptr[i] = first byte of line i (caller array) */
+    size_t* len;      /**< len[i] = bytes in line i, terminator excluded (caller array) */
+    size_t n;         /**< Lines held */
+    size_t max;       /**< Capacity of ptr and len */
+} sno_batch_t;
+
+/** Initialize empty batch over caller arrays ptr[max], len[max] */
+void sno_batch(sno_batch_t* b, cstr_t** ptr, size_t* len, size_t max);
+
+/** Append line [p, p + n); false when full */
+bool sno_batch_add(sno_batch_t* b, cstr_t* p, size_t n);
+
+/**
+ * Append the delim-separated records of buf[0..len) as sno_records yields them
+ * (CR stripped when delim is '\n'). Returns bytes consumed, less than len when
+ * the batch filled; call again from buf + consumed with an emptied batch.
+ */
+size_t sno_batch_records(sno_batch_t* b, cstr_t* buf, size_t len, char delim);
+
+/** Run fn(subject, ctx) from the start of every line; returns lines matched */
+size_t sno_match_batch(const sno_batch_t* b, sno_record_fn fn, void* ctx, unsigned char* hits);
+
+/** Run compiled pattern p from the start of every line (sno_match); returns lines matched */
+size_t sno_match_batch_pat(const sno_batch_t* b, const sno_pat_t* p, unsigned char* hits);
+
+#define sno_batch_hit(hits, i) (((hits)[(i) >> 3] >> ((i) & 7)) & 1)
+
+#endif
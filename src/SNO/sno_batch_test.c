@@ -0,0 +1,103 @@
+#include "sno_batch_test.h"
+#include "sno_constants.h"
+#include <assert.h>
+#include <string.h>
+
+/* "ERROR " then a code of digits */
+static bool is_error(sno_subject_t* s, void* ctx)
+{
+    (void)ctx;
+    return sno_lit(s, "ERROR ") && sno_span(s, SNO_DIGITS);
+}
+
+/* Counts calls through ctx */
+static bool count_calls(sno_subject_t* s, void* ctx)
+{
+    (*(size_t*)ctx)++;
+    return sno_rem(s) && s->view.end > s->view.begin;
+}
+
+void sno_batch_test()
+{
+    cstr_t* log = "INFO start\nERROR 42 disk\nWARN fan\r\nERROR x\nERROR 7\n\nINFO stop";
+    cstr_t* ptr[8];
+    size_t len[8];
+    unsigned char hits[2];
+    sno_batch_t b;
+    size_t calls = 0, used, i;
+
+    /* Build from a buffer: CR stripped, empty record kept */
+    sno_batch(&b, ptr, len, 8);
+    used = sno_batch_records(&b, log, strlen(log), '\n');
+    assert(used == strlen(log) && b.n == 7);
+    assert(len[0] == 10 && memcmp(ptr[0], "INFO start", 10) == 0);
+    assert(len[2] == 8 && memcmp(ptr[2], "WARN fan", 8) == 0);
+    assert(len[5] == 0 && len[6] == 9);
+
+    /* Function pattern: bit per line */
+    assert(sno_match_batch(&b, is_error, NULL, hits) == 2);
+    assert(hits[0] == ((1 << 1) | (1 << 4)));
+    assert(sno_batch_hit(hits, 1) && !sno_batch_hit(hits, 3) && sno_batch_hit(hits, 4));
+
+    /* ctx reaches every call; empty line fails */
+    memset(hits, 0xFF, sizeof(hits));
+    assert(sno_match_batch(&b, count_calls, &calls, hits) == 6 && calls == 7);
+    assert(hits[0] == (0x7F & ~(1 << 5)));     /* stale bits cleared */
+    assert(hits[1] == 0xFF);                      /* only (n + 7) / 8 bytes written */
+
+    /* Compiled pattern, anchor prefilter must not change results */
+    {
+        sno_pat_t p;
+        unsigned char code[96];
+        sno_pat(&p, code, sizeof(code));
+        sno_pat_lit(&p, "ERROR ");
+        sno_pat_span(&p, SNO_DIGITS);
+        assert(sno_pat_done(&p));
+        assert(sno_match_batch_pat(&b, &p, hits) == 2);
+        assert(hits[0] == ((1 << 1) | (1 << 4)));
+
+        /* Anchor present but not at the start: matcher still decides */
+        sno_batch(&b, ptr, len, 8);
+        sno_batch_add(&b, "x ERROR 1", 9);
+        sno_batch_add(&b, "ERROR 1", 7);
+        assert(sno_match_batch_pat(&b, &p, hits) == 1 && hits[0] == 2);
+
+        /* Pattern without anchor */
+        sno_pat(&p, code, sizeof(code));
+        sno_pat_any(&p, "E");
+        sno_pat_span(&p, SNO_LETTERS);
+        assert(sno_pat_done(&p));
+        assert(sno_match_batch_pat(&b, &p, hits) == 1 && hits[0] == 2);
+
+        /* Unfinished pattern matches nothing */
+        sno_pat(&p, code, sizeof(code));
+        sno_pat_alt(&p);
+        assert(!sno_pat_done(&p));
+        assert(sno_match_batch_pat(&b, &p, hits) == 0);
+    }
+
+    /* Batch fills: resume where it stopped */
+    sno_batch(&b, ptr, len, 3);
+    used = sno_batch_records(&b, log, strlen(log), '\n');
+    assert(b.n == 3 && memcmp(log + used, "ERROR x", 7) == 0);
+    assert(!sno_batch_add(&b, "y", 1));
+    sno_batch(&b, ptr, len, 8);
+    used += sno_batch_records(&b, log + used, strlen(log) - used, '\n');
+    assert(used == strlen(log) && b.n == 4);
+
+    /* Larger batch spans several bitmap bytes; prefetch runs past lines */
+    {
+        static cstr_t* many[20];
+        static size_t many_len[20];
+        unsigned char bits[3];
+        sno_batch(&b, many, many_len, 20);
+        for (i = 0; i < 20; i++) sno_batch_add(&b, i % 3 ? "INFO" : "ERROR 9", i % 3 ? 4 : 7);
+        assert(sno_match_batch(&b, is_error, NULL, bits) == 7);
+        for (i = 0; i < 20; i++) assert(sno_batch_hit(bits, i) == (i % 3 == 0));
+    }
+
+    /* NULL guards */
+    assert(sno_match_batch(NULL, is_error, NULL, hits) == 0);
+    assert(sno_match_batch(&b, NULL, NULL, hits) == 0);
+    assert(sno_batch_records(NULL, log, 1, '\n') == 0);
+}
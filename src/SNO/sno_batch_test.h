@@ -0,0 +1,9 @@
+#ifndef SNO_BATCH_TEST_H
+#define SNO_BATCH_TEST_H
+
+#include "sno_batch.h"
+#include <stdio.h>
+
+void sno_batch_test();
+
+#endif
@@ -3,6 +3,8 @@
 #ifndef SNO_CONSTANTS_H
 #define SNO_CONSTANTS_H
 
+#include "sno.h"
+
 /**
  * @file sno_constants.h
  * @brief Predefined character sets for sno_any, sno_span, sno_break, sno_notany
@@ -36,4 +38,19 @@
 /** Hexadecimal digits (0-9, A-F, a-f) */
 #define SNO_HEX_DIGITS     "0123456789ABCDEFabcdef"
 
+/**
+ * Precompiled bitmaps for sno_any_cset, sno_span_cset, sno_break_cset, sno_notany_cset
+ *
+ * Each SNO_CSET_* holds exactly the characters of its SNO_* string counterpart,
+ * initialized at compile time (sno_constants.c)—O(1) membership, no sno_cset() setup.
+ */
+extern const sno_cset_t SNO_CSET_LETTERS;
+extern const sno_cset_t SNO_CSET_DIGITS;
+extern const sno_cset_t SNO_CSET_ALNUM;
+extern const sno_cset_t SNO_CSET_ALNUM_U;
+extern const sno_cset_t SNO_CSET_WHITESPACE;
+extern const sno_cset_t SNO_CSET_OPSYMS;
+extern const sno_cset_t SNO_CSET_PUNCTUATION;
+extern const sno_cset_t SNO_CSET_HEX_DIGITS;
+
 #endif
@@ -0,0 +1,144 @@
+/* sno_inline.h — Inline definitions of the single-step primitives */
+
+#ifndef SNO_INLINE_H
+#define SNO_INLINE_H
+
+#include "sno.h"
+#include <string.h>
+
+/**
+ * @file sno_inline.h
+ * @brief static inline primitives so && / || chains fold into the caller
+ *
+ * Two families, both identical in behaviour to the sno.c functions:
+ *   - sno_<name>_inline: checked (NULL guards), what SNO_INLINE maps the
+ *     public names to
+ *   - sno_<name>_u: unchecked; the caller guarantees s, and any set or
+ *     literal argument, are valid. Use inside hot loops over a subject
+ *     already known to be bound.
+ *
+ * Including this header is always allowed; defining SNO_INLINE before
+ * including sno.h additionally routes sno_ch, sno_lit, sno_len, sno_any,
+ * sno_notany, sno_any_cset, sno_notany_cset, sno_tab, sno_rtab, sno_rem and
+ * sno_mark through the inline versions (function-like macros, so taking
+ * the address of a primitive still yields the out-of-line function).
+ * Scanning primitives (span/break, find_lit, bal) stay out of line: they
+ * dispatch to the SIMD kernels.
+ */
+
+#ifndef SNO_INL
+#define SNO_INL static inline
+#endif
+
+/* === Unchecked === */
+
+SNO_INL bool sno_ch_u(sno_subject_t* s, char ch)
+{
+    if (s->view.end == s->str.end || *s->view.end != ch) return false;
+    s->view.begin = s->view.end++;
+    return true;
+}
+
+SNO_INL bool sno_lit_u(sno_subject_t* s, const char* lit)
+{
+    cstr_t* pos = s->view.end;
+    while (*lit && pos < s->str.end && *pos == *lit) {
+        pos++;
+        lit++;
+    }
+    if (*lit) return false;
+    s->view.begin = s->view.end;
+    s->view.end = pos;
+    return true;
+}
+
+SNO_INL bool sno_len_u(sno_subject_t* s, size_t n)
+{
+    if (n > (size_t)(s->str.end - s->view.end)) return false;  /* past end of string */
+    s->view.begin = s->view.end;
+    s->view.end += n;
+    return true;
+}
+
+SNO_INL bool sno_any_u(sno_subject_t* s, const char* set)
+{
+    cstr_t* pos = s->view.end;
+    if (pos == s->str.end || *pos == '\0' || !strchr(set, *pos)) return false;
+    s->view.begin = pos;
+    s->view.end = pos + 1;
+    return true;
+}
+
+SNO_INL bool sno_notany_u(sno_subject_t* s, const char* set)
+{
+    cstr_t* pos = s->view.end;
+    if (pos == s->str.end || (*pos != '\0' && strchr(set, *pos))) return false;
+    s->view.begin = pos;
+    s->view.end = pos + 1;
+    return true;
+}
+
+SNO_INL bool sno_any_cset_u(sno_subject_t* s, const sno_cset_t* cs)
+{
+    cstr_t* pos = s->view.end;
+    if (pos == s->str.end || !sno_cset_has(cs, *pos)) return false;
+    s->view.begin = pos;
+    s->view.end = pos + 1;
+    return true;
+}
+
+SNO_INL bool sno_notany_cset_u(sno_subject_t* s, const sno_cset_t* cs)
+{
+    cstr_t* pos = s->view.end;
+    if (pos == s->str.end || sno_cset_has(cs, *pos)) return false;
+    s->view.begin = pos;
+    s->view.end = pos + 1;
+    return true;
+}
+
+SNO_INL bool sno_tab_u(sno_subject_t* s, size_t n)
+{
+    size_t cur = (size_t)(s->view.end - s->str.begin);
+    if (n < cur || n > s->length) return false;   /* leftward move or beyond end → fail */
+    s->view.begin = s->view.end;
+    s->view.end = s->str.begin + n;
+    return true;
+}
+
+SNO_INL bool sno_rtab_u(sno_subject_t* s, size_t n)
+{
+    size_t cur = (size_t)(s->view.end - s->str.begin);
+    if (n > s->length || s->length - n < cur) return false;   /* before start or leftward */
+    s->view.begin = s->view.end;
+    s->view.end = s->str.begin + (s->length - n);
+    return true;
+}
+
+SNO_INL bool sno_rem_u(sno_subject_t* s)
+{
+    s->view.begin = s->view.end;
+    s->view.end = s->str.end;
+    return true;
+}
+
+SNO_INL bool sno_mark_u(sno_subject_t* s)
+{
+    s->mark = s->view.end;
+    return true;
+}
+
+/* === Checked === */
+
+SNO_INL bool sno_ch_inline(sno_subject_t* s, char ch)  { return s && sno_ch_u(s, ch); }
+SNO_INL bool sno_lit_inline(sno_subject_t* s, const char* lit) { return s && lit && sno_lit_u(s, lit); }
+SNO_INL bool sno_len_inline(sno_subject_t* s, size_t n) { return s && sno_len_u(s, n); }
+SNO_INL bool sno_any_inline(sno_subject_t* s, const char* set) { return s && set && sno_any_u(s, set); }
+SNO_INL bool sno_notany_inline(sno_subject_t* s, const char* set) { return s && set && sno_notany_u(s, set); }
+SNO_INL bool sno_any_cset_inline(sno_subject_t* s, const sno_cset_t* cs) { return s && cs && sno_any_cset_u(s, cs); }
+SNO_INL bool sno_notany_cset_inline(sno_subject_t* s, const sno_cset_t* cs) { return s && cs && sno_notany_cset_u(s, cs); }
+SNO_INL bool sno_tab_inline(sno_subject_t* s, size_t n)  { return s && sno_tab_u(s, n); }
+SNO_INL bool sno_rtab_inline(sno_subject_t* s, size_t n) { return s && sno_rtab_u(s, n); }
+SNO_INL bool sno_rem_inline(sno_subject_t* s)  { return s && sno_rem_u(s); }
+SNO_INL bool sno_mark_inline(sno_subject_t* s) { return s && sno_mark_u(s); }
+
+#endif
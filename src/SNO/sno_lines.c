@@ -0,0 +1,64 @@
+#include "sno_lines.h"
+#include <string.h>
+
+/* === Internal Helpers === */
+
+/* End of record starting at pos: next delimiter or range end */
+static cstr_t* sno_lines_stop(const sno_lines_t* it, cstr_t* pos)
+{
+    cstr_t* hit = (cstr_t*)memchr(pos, it->delim, (size_t)(it->end - pos));
+    return hit ? hit : it->end;
+}
+
+/* === Iteration === */
+
+void sno_records(sno_lines_t* it, const sno_subject_t* s, char delim)
+{
+    if (!it || !s) return;
+    it->begin = it->pos = s->view.end;
+    it->end = s->str.end;
+    it->n = 0;
+    it->delim = delim;
+}
+
+void sno_lines(sno_lines_t* it, const sno_subject_t* s)
+{
+    sno_records(it, s, '\n');
+}
+
+bool sno_lines_next(sno_lines_t* it, sno_subject_t* rec)
+{
+    cstr_t* stop;
+    cstr_t* last;
+    if (!it || !rec || it->pos >= it->end) return false;
+    stop = sno_lines_stop(it, it->pos);
+    last = stop;
+    if (it->delim == '\n' && last > it->pos && last[-1] == '\r') last--;   /* CRLF */
+    sno_bind_n(rec, it->pos, (size_t)(last - it->pos));
+    it->pos = stop < it->end ? stop + 1 : stop;
+    it->n++;
+    return true;
+}
+
+/* === Index === */
+
+size_t sno_lines_index(const sno_lines_t* it, size_t* offsets, size_t max)
+{
+    cstr_t* pos;
+    size_t count = 0;
+    if (!it) return 0;
+    for (pos = it->pos; pos < it->end; count++) {
+        if (offsets && count < max) offsets[count] = (size_t)(pos - it->begin);
+        pos = sno_lines_stop(it, pos);
+        if (pos < it->end) pos++;
+    }
+    return count;
+}
+
+bool sno_lines_seek(sno_lines_t* it, const size_t* offsets, size_t count, size_t i)
+{
+    if (!it || !offsets || i >= count) return false;
+    it->pos = it->begin + offsets[i];
+    it->n = i;
+    return true;
+}
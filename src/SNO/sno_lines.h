@@ -0,0 +1,49 @@
+/* sno_lines.h — Line/record iteration over a bound subject */
+
+#ifndef SNO_LINES_H
+#define SNO_LINES_H
+
+#include "sno.h"
+
+/**
+ * @file sno_lines.h
+ * @brief Yield one bounded sub-subject per record, with optional offset index
+ *
+ * Replaces the hand-written break / bind / parse / skip-newline loop. Each call
+ * to sno_lines_next() binds a record subject (via sno_bind_n) to the next
+ * record without its delimiter; for '\n' records a trailing '\r' is also
+ * dropped, so CRLF input parses the same as LF. A final record without a
+ * delimiter is still yielded; a trailing delimiter yields no empty record.
+ *
+ * Records are located with memchr, which is vectorized on host C libraries.
+ * sno_lines_index() records every record start in one pass so later passes
+ * can sno_lines_seek() straight to record N.
+ */
+
+typedef struct {
+    cstr_t* begin;   /**< Start of iterated range (index offsets are relative to it) */
+    cstr_t* pos;     /**< Start of next record */
+    cstr_t* end;     /**< Exclusive end of range */
+    size_t n;        /**< Index of next record */
+    char delim;      /**< Record delimiter */
+} sno_lines_t;
+
+/** Iterate '\n'-delimited lines from s cursor to s end; s itself is not modified */
+void sno_lines(sno_lines_t* it, const sno_subject_t* s);
+
+/** Iterate records delimited by delim (no '\r' stripping unless delim is '\n') */
+void sno_records(sno_lines_t* it, const sno_subject_t* s, char delim);
+
+/** Bind rec to the next record; false when the range is exhausted */
+bool sno_lines_next(sno_lines_t* it, sno_subject_t* rec);
+
+/**
+ * Store start offsets of up to max records (from current position) in offsets[].
+ * Returns total record count, which may exceed max. Does not advance the iterator.
+ */
+size_t sno_lines_index(const sno_lines_t* it, size_t* offsets, size_t max);
+
+/** Position iterator at record i using an index built by sno_lines_index() on a fresh iterator */
+bool sno_lines_seek(sno_lines_t* it, const size_t* offsets, size_t count, size_t i);
+
+#endif
@@ -0,0 +1,66 @@
+#include "sno_lines_test.h"
+#include "sno_constants.h"
+#include "sno_str.h"
+#include <assert.h>
+#include <string.h>
+
+void sno_lines_test(void) {
+    sno_subject_t s = {0}, rec = {0};
+    sno_lines_t it;
+    size_t offs[8], n;
+
+    /* LF, CRLF, empty line, final line without newline */
+    sno_bind(&s, "alpha=1\r\nbeta=22\n\ngamma=333");
+    sno_lines(&it, &s);
+    assert(sno_lines_next(&it, &rec));
+    assert(rec.length == 7 && sno_at_r(&rec, 7));                  /* '\r' dropped */
+    assert(sno_span(&rec, SNO_LETTERS) && sno_view_eq(rec.view, "alpha"));
+    assert(sno_ch(&rec, '=') && sno_span(&rec, SNO_DIGITS) && sno_at_r(&rec, 0));
+    assert(sno_lines_next(&it, &rec) && sno_rem(&rec) && sno_view_eq(rec.view, "beta=22"));
+    assert(sno_lines_next(&it, &rec) && rec.length == 0);          /* empty line */
+    assert(sno_lines_next(&it, &rec) && sno_rem(&rec) && sno_view_eq(rec.view, "gamma=333"));
+    assert(it.n == 4);
+    assert(!sno_lines_next(&it, &rec));
+    assert(s.view.end == s.str.begin);                             /* source untouched */
+
+    /* Trailing newline yields no empty record; lone CR is kept */
+    sno_bind(&s, "a\rb\n");
+    sno_lines(&it, &s);
+    assert(sno_lines_next(&it, &rec) && rec.length == 3);
+    assert(!sno_lines_next(&it, &rec));
+
+    /* Iteration starts at cursor */
+    sno_bind(&s, "HDR\nx\ny\n");
+    assert(sno_lit(&s, "HDR\n"));
+    sno_lines(&it, &s);
+    assert(sno_lines_next(&it, &rec) && sno_lit(&rec, "x") && sno_at_r(&rec, 0));
+
+    /* Custom delimiter, no CR stripping */
+    sno_bind(&s, "a;b\r;c");
+    sno_records(&it, &s, ';');
+    assert(sno_lines_next(&it, &rec) && rec.length == 1);
+    assert(sno_lines_next(&it, &rec) && rec.length == 2);
+    assert(sno_lines_next(&it, &rec) && rec.length == 1 && !sno_lines_next(&it, &rec));
+
+    /* Index once, seek straight to record N */
+    sno_bind(&s, "r0\nr1\r\nr2\nr3\nr4");
+    sno_lines(&it, &s);
+    n = sno_lines_index(&it, offs, 8);
+    assert(n == 5);
+    assert(offs[0] == 0 && offs[1] == 3 && offs[2] == 7 && offs[4] == 13);
+    assert(sno_lines_index(&it, offs, 2) == 5);                    /* count beyond max */
+    assert(sno_lines_index(&it, NULL, 0) == 5);
+    n = sno_lines_index(&it, offs, 8);
+    assert(sno_lines_seek(&it, offs, n, 3));
+    assert(sno_lines_next(&it, &rec) && sno_lit(&rec, "r3") && it.n == 4);
+    assert(sno_lines_seek(&it, offs, n, 1));
+    assert(sno_lines_next(&it, &rec) && rec.length == 2 && sno_lit(&rec, "r1"));
+    assert(!sno_lines_seek(&it, offs, n, 5));
+
+    /* Empty input, NULL guards */
+    sno_bind(&s, "");
+    sno_lines(&it, &s);
+    assert(!sno_lines_next(&it, &rec) && sno_lines_index(&it, offs, 8) == 0);
+    assert(!sno_lines_next(NULL, &rec) && !sno_lines_next(&it, NULL));
+    assert(sno_lines_index(NULL, offs, 8) == 0);
+}
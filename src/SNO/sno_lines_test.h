@@ -0,0 +1,9 @@
+#ifndef SNO_LINES_TEST_H
+#define SNO_LINES_TEST_H
+
+#include "sno_lines.h"
+#include <stdio.h>
+
+void sno_lines_test();
+
+#endif
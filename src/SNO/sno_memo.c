@@ -0,0 +1,75 @@
+#include "sno_memo.h"
+#include <string.h>
+
+/* === Internal Helpers === */
+
+/* Home slot for (rule, pos) */
+#define sno_memo_home(m, rule, pos) (((pos) * 31u + (size_t)(rule) * 0x9E37u) % (m)->size)
+
+/* === Table Management === */
+
+void sno_memo_init(sno_memo_t* m, sno_memo_entry_t* table, size_t size)
+{
+    if (!m) return;
+    m->table = table;
+    m->size = table ? size : 0;
+    m->gen = 0;
+    m->hits = m->misses = 0;
+    if (m->size) memset(table, 0, size * sizeof(*table));
+}
+
+bool sno_memo_attach(sno_subject_t* s, sno_memo_t* m)
+{
+    if (!s || !m || !m->size) return false;
+    if (++m->gen == 0) {                             /* wrapped: stale gens could collide */
+        memset(m->table, 0, m->size * sizeof(*m->table));
+        m->gen = 1;
+    }
+    s->memo = m;
+    return true;
+}
+
+/* === Memoized Rules === */
+
+bool sno_memo(sno_subject_t* s, unsigned rule_id, sno_rule_fn fn)
+{
+    sno_memo_t* m;
+    sno_memo_entry_t* e;
+    sno_memo_entry_t* slot = NULL;
+    cstr_t* start;
+    size_t pos, i, h;
+    bool ok;
+
+    if (!s || !fn) return false;
+    if ((m = s->memo) == NULL) return fn(s);
+    start = s->view.end;
+    pos = (size_t)(start - s->str.begin);
+    h = sno_memo_home(m, rule_id, pos);
+
+    for (i = 0; i < SNO_MEMO_PROBE && i < m->size; i++) {
+        e = &m->table[(h + i) % m->size];
+        if (e->gen != m->gen) {                      /* free slot ends the probe */
+            if (!slot) slot = e;
+            break;
+        }
+        if (e->pos == pos && e->rule == rule_id) {
+            m->hits++;
+            if (!e->ok) return false;
+            s->view.begin = start;
+            s->view.end = s->str.begin + e->end;
+            return true;
+        }
+    }
+
+    m->misses++;
+    ok = fn(s);
+    if (s->memo != m) return ok;                     /* rule rebound the subject */
+    if (!slot) slot = &m->table[h];                  /* probe full: evict home */
+    slot->pos = pos;
+    slot->rule = rule_id;
+    slot->gen = m->gen;
+    slot->ok = ok;
+    slot->end = (size_t)(s->view.end - s->str.begin);
+    if (ok) s->view.begin = start;
+    return ok;
+}
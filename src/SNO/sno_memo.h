@@ -0,0 +1,62 @@
+/* sno_memo.h — Packrat memoization for recursive grammars */
+
+#ifndef SNO_MEMO_H
+#define SNO_MEMO_H
+
+#include "sno.h"
+
+/**
+ * @file sno_memo.h
+ * @brief Cache (rule, cursor offset) → (success, end offset) for recursive descent
+ *
+ * Grammars whose alternatives re-parse the same sub-expression from the same
+ * position go exponential; wrapping each rule body in sno_memo() makes every
+ * (rule, position) pair run at most once, so the parse stays linear.
+ *
+ * The table is a caller-supplied entry array (static or arena memory on DOS),
+ * probed linearly for SNO_MEMO_PROBE slots and then overwritten, so a table
+ * smaller than rules × subject length degrades to recomputation rather than
+ * failing. Entries carry a generation number: attaching the memo to a new
+ * parse invalidates every entry in O(1).
+ *
+ * A hit restores the cursor only; marks and capture slots set inside the rule
+ * are not replayed, so memoize recognisers and capture at the call site.
+ * Left-recursive rules are not supported (they recurse before any entry exists).
+ */
+
+#ifndef SNO_MEMO_PROBE
+#define SNO_MEMO_PROBE 4
+#endif
+
+/** Rule body: a pattern over s obeying the failure contract */
+typedef bool (*sno_rule_fn)(sno_subject_t* s);
+
+typedef struct {
+    size_t pos;             /**< Cursor offset at rule entry */
+    size_t end;             /**< Cursor offset after success */
+    unsigned rule;          /**< Rule id (full width: ids never alias) */
+    unsigned short gen;     /**< Generation; valid iff equal to table gen */
+    bool ok;                /**< Cached outcome */
+} sno_memo_entry_t;
+
+typedef struct sno_memo_s {
+    sno_memo_entry_t* table;  /**< Entries (caller-owned) */
+    size_t size;              /**< Entry count */
+    unsigned short gen;       /**< Current generation (never 0) */
+    unsigned long hits;       /**< Lookups answered from the table */
+    unsigned long misses;     /**< Lookups that ran the rule */
+} sno_memo_t;
+
+/** Initialize memo over table[0..size) */
+void sno_memo_init(sno_memo_t* m, sno_memo_entry_t* table, size_t size);
+
+/** Attach memo to subject for a new parse (after sno_bind); invalidates all entries */
+bool sno_memo_attach(sno_subject_t* s, sno_memo_t* m);
+
+/**
+ * Run rule fn at cursor, or answer from the memo. On success view spans the
+ * rule's match. Without an attached memo, simply calls fn.
+ */
+bool sno_memo(sno_subject_t* s, unsigned rule_id, sno_rule_fn fn);
+
+#endif
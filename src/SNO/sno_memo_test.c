@@ -0,0 +1,101 @@
+#include "sno_memo_test.h"
+#include "sno_constants.h"
+#include <assert.h>
+#include <limits.h>
+#include <string.h>
+
+/*
+ * expr := term '+' expr | term
+ * term := '(' expr ')' | digits
+ * Each level parses term twice, so plain recursive descent is O(2^depth).
+ */
+enum { RULE_EXPR, RULE_TERM };
+
+static unsigned long calls;
+
+static bool term(sno_subject_t* s);
+
+static bool expr_body(sno_subject_t* s)
+{
+    cstr_t* start = s->view.end;
+    calls++;
+    if (term(s) && sno_ch(s, '+') && sno_memo(s, RULE_EXPR, expr_body)) return true;
+    sno_rollback_n(s, start);
+    return term(s);
+}
+
+static bool term_body(sno_subject_t* s)
+{
+    cstr_t* start = s->view.end;
+    calls++;
+    if (sno_ch(s, '(') && sno_memo(s, RULE_EXPR, expr_body) && sno_ch(s, ')')) return true;
+    sno_rollback_n(s, start);
+    return sno_span(s, SNO_DIGITS);
+}
+
+static bool term(sno_subject_t* s) { return sno_memo(s, RULE_TERM, term_body); }
+
+/* Succeeds wherever term fails: catches a lookup answered for another rule */
+static bool any_body(sno_subject_t* s)
+{
+    calls++;
+    return sno_len(s, 1);
+}
+
+void sno_memo_test(void) {
+    static sno_memo_entry_t table[256];
+    static char deep[64];
+    sno_subject_t s = {0};
+    sno_memo_t m;
+    unsigned long plain;
+    size_t i, d = 16;
+
+    for (i = 0; i < d; i++) deep[i] = '(';
+    deep[d] = '1';
+    for (i = 0; i < d; i++) deep[d + 1 + i] = ')';
+    deep[2 * d + 1] = '\0';
+
+    /* No memo attached: exponential */
+    sno_bind(&s, deep);
+    calls = 0;
+    assert(sno_memo(&s, RULE_EXPR, expr_body) && sno_at_r(&s, 0));
+    plain = calls;
+    assert(plain > 1ul << d);
+
+    /* Memoized: each (rule, position) runs once */
+    sno_memo_init(&m, table, 256);
+    sno_bind(&s, deep);
+    assert(sno_memo_attach(&s, &m));
+    calls = 0;
+    assert(sno_memo(&s, RULE_EXPR, expr_body) && sno_at_r(&s, 0));
+    assert(s.view.begin == s.str.begin);                            /* view spans rule match */
+    assert(calls <= 2 * (2 * d + 2) && m.hits > 0);
+
+    /* Failure is cached too, cursor unchanged */
+    sno_bind(&s, "((1)+2");
+    assert(sno_memo_attach(&s, &m));
+    assert(!sno_memo(&s, RULE_EXPR, expr_body) && s.view.end == s.str.begin);   /* unclosed '(' */
+    sno_bind(&s, "(1+2)+3)");
+    assert(sno_memo_attach(&s, &m));
+    assert(sno_memo(&s, RULE_EXPR, expr_body) && sno_at(&s, 7));
+    assert(sno_ch(&s, ')'));
+    sno_bind(&s, "+1");
+    assert(sno_memo_attach(&s, &m));
+    assert(!sno_memo(&s, RULE_TERM, term_body) && s.view.end == s.str.begin);
+    calls = 0;
+    assert(!sno_memo(&s, RULE_TERM, term_body) && calls == 0);        /* answered from table */
+#if UINT_MAX > 0xFFFFu
+    assert(sno_memo(&s, RULE_TERM + 0x10000u, any_body) && calls == 1);   /* ids never alias */
+#endif
+
+    /* Tiny table still correct (evictions only cost recomputation) */
+    sno_memo_init(&m, table, 3);
+    sno_bind(&s, deep);
+    assert(sno_memo_attach(&s, &m));
+    assert(sno_memo(&s, RULE_EXPR, expr_body) && sno_at_r(&s, 0));
+
+    /* Rebinding detaches */
+    sno_bind(&s, "1");
+    assert(s.memo == NULL);
+    assert(!sno_memo_attach(&s, NULL) && !sno_memo(NULL, 0, term_body) && !sno_memo(&s, 0, NULL));
+}
@@ -0,0 +1,9 @@
+#ifndef SNO_MEMO_TEST_H
+#define SNO_MEMO_TEST_H
+
+#include "sno_memo.h"
+#include <stdio.h>
+
+void sno_memo_test();
+
+#endif
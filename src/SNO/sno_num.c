@@ -0,0 +1,254 @@
+#include "sno_num.h"
+#include <errno.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(SNO_NO_SIMD) && defined(__GNUC__) && (defined(__x86_64__) || defined(__aarch64__)) && \
+    defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define SNO_NUM_SWAR 1
+#endif
+
+/* Significant decimal digits a uint64_t mantissa holds without overflow */
+#define SNO_NUM_MANT_DIGITS 19
+
+/* Exact powers of ten representable in a double (Clinger's fast path) */
+static const double sno_pow10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/* === Internal Helpers === */
+
+/* Commit [start, end) as the view */
+static bool sno_num_take(sno_subject_t* s, cstr_t* start, cstr_t* end)
+{
+    s->view.begin = start;
+    s->view.end = end;
+    return true;
+}
+
+/*
+ * Mantissa text [p, end) (digits, at most one '.') times 10^exp10 through
+ * strtod, at any length: leading zeros are dropped and digits past
+ * SNO_NUM_FLOAT_DIGITS fold into one sticky '1', which keeps the rounding
+ * direction. false on overflow.
+ */
+static bool sno_num_strtod(cstr_t* p, cstr_t* end, long exp10, double* out)
+{
+    char buf[SNO_NUM_FLOAT_DIGITS + 16];        /* digits, sticky digit, "e-1000000", '\0' */
+    size_t k = 0;
+    bool frac = false, sticky = false;
+    double d;
+    for (; p < end; p++) {
+        if (*p == '.') {
+            frac = true;
+        }
+        else if (k == 0 && *p == '0') {
+            if (frac) exp10--;                       /* leading zero */
+        }
+        else if (k < SNO_NUM_FLOAT_DIGITS) {
+            buf[k++] = *p;
+            if (frac) exp10--;
+        }
+        else {
+            if (!frac) exp10++;                      /* dropped integer digit */
+            if (*p != '0') sticky = true;
+        }
+        if (exp10 > 1000000L) exp10 = 1000000L;      /* far outside double range either way */
+        if (exp10 < -1000000L) exp10 = -1000000L;
+    }
+    if (k == 0) {
+        *out = 0.0;
+        return true;
+    }
+    if (sticky) {
+        buf[k++] = '1';
+        exp10--;
+    }
+    sprintf(buf + k, "e%ld", exp10);
+    errno = 0;
+    d = strtod(buf, NULL);
+    if (errno == ERANGE && d == HUGE_VAL) return false;   /* overflow */
+    *out = d;
+    return true;
+}
+
+#if defined(SNO_NUM_SWAR)
+
+/* True when all 8 bytes of w are '0'..'9' */
+#define sno_swar_digits(w) \
+    ((((w) & 0xF0F0F0F0F0F0F0F0ull) | ((((w) + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4)) \
+     == 0x3333333333333333ull)
+
+/* Value of 8 ASCII digits, first digit in the low byte */
+static uint64_t sno_swar_value(uint64_t w)
+{
+    w -= 0x3030303030303030ull;
+    w = (w * 10) + (w >> 8);                                   /* pairs */
+    w = (((w & 0x000000FF000000FFull) * (100 + (1000000ull << 32))) +
+         (((w >> 16) & 0x000000FF000000FFull) * (1 + (10000ull << 32)))) >> 32;
+    return w;
+}
+
+#endif
+
+/*
+ * Accumulate decimal digits from p while n stays ≤ limit.
+ * Returns the first non-digit, or NULL on overflow; *n holds the value.
+ */
+static cstr_t* sno_num_decimal(cstr_t* p, cstr_t* end, uint64_t limit, uint64_t* n)
+{
+    uint64_t v = 0;
+#if defined(SNO_NUM_SWAR)
+    while (end - p >= 8) {
+        uint64_t w;
+        memcpy(&w, p, sizeof(w));                              /* unaligned-safe load */
+        if (!sno_swar_digits(w)) break;
+        w = sno_swar_value(w);
+        if (v > (limit - w) / 100000000u) return NULL;         /* overflow */
+        v = v * 100000000u + w;
+        p += 8;
+    }
+#endif
+    for (; p < end; p++) {
+        unsigned d = (unsigned char)*p - '0';
+        if (d > 9) break;
+        if (v > (limit - d) / 10) return NULL;                 /* overflow */
+        v = v * 10 + d;
+    }
+    *n = v;
+    return p;
+}
+
+/* Hex digit value, or 16 when c is not one */
+static unsigned sno_num_xdigit(unsigned char c)
+{
+    if ((unsigned)(c - '0') < 10) return c - '0';
+    c |= 0x20;
+    if ((unsigned)(c - 'a') < 6) return c - 'a' + 10;
+    return 16;
+}
+
+/* === Integers === */
+
+bool sno_uint(sno_subject_t* s, uint32_t* out)
+{
+    uint64_t n;
+    cstr_t* pos;
+    if (!s || !out) return false;
+    pos = sno_num_decimal(s->view.end, s->str.end, UINT32_MAX, &n);
+    if (!pos || pos == s->view.end) return false;              /* overflow or no digits */
+    *out = (uint32_t)n;
+    return sno_num_take(s, s->view.end, pos);
+}
+
+bool sno_int(sno_subject_t* s, int64_t* out)
+{
+    uint64_t n;
+    cstr_t* start;
+    cstr_t* p;
+    cstr_t* pos;
+    bool neg;
+    if (!s || !out) return false;
+    start = p = s->view.end;
+    neg = p < s->str.end && *p == '-';
+    if (p < s->str.end && (neg || *p == '+')) p++;
+    pos = sno_num_decimal(p, s->str.end, neg ? (uint64_t)INT64_MAX + 1 : (uint64_t)INT64_MAX, &n);
+    if (!pos || pos == p) return false;                        /* overflow, or sign only */
+    *out = (neg && n) ? -(int64_t)(n - 1) - 1 : (int64_t)n;    /* INT64_MIN without overflow */
+    return sno_num_take(s, start, pos);
+}
+
+bool sno_hex(sno_subject_t* s, uint32_t* out)
+{
+    uint32_t n = 0;
+    cstr_t* p;
+    unsigned d;
+    if (!s || !out) return false;
+    for (p = s->view.end; p < s->str.end && (d = sno_num_xdigit((unsigned char)*p)) < 16; p++) {
+        if (n > (UINT32_MAX >> 4)) return false;               /* overflow */
+        n = (n << 4) | d;
+    }
+    if (p == s->view.end) return false;
+    *out = n;
+    return sno_num_take(s, s->view.end, p);
+}
+
+/* === Floating Point === */
+
+bool sno_float(sno_subject_t* s, double* out)
+{
+    cstr_t* start;
+    cstr_t* mstart;
+    cstr_t* mend;
+    cstr_t* p;
+    cstr_t* end;
+    uint64_t mant = 0;
+    unsigned sig = 0, digits = 0;     /* significant digits kept; mantissa digits seen */
+    long exp10 = 0;                   /* power of ten applied to mant */
+    long lexp = 0;                    /* exponent as written */
+    bool neg, exact = true;
+    double d;
+
+    if (!s || !out) return false;
+    start = p = s->view.end;
+    end = s->str.end;
+    neg = p < end && *p == '-';
+    if (p < end && (neg || *p == '+')) p++;
+    mstart = p;
+
+    /* Mantissa: integer part, then fraction; count digits beyond the 19 kept */
+    for (; p < end && (unsigned)(*p - '0') < 10; p++, digits++) {
+        if (sig < SNO_NUM_MANT_DIGITS) {
+            mant = mant * 10 + (unsigned)(*p - '0');
+            if (mant) sig++;
+        }
+        else {
+            exp10++;
+            if (*p != '0') exact = false;
+        }
+    }
+    if (p < end && *p == '.') {
+        cstr_t* frac = ++p;
+        for (; p < end && (unsigned)(*p - '0') < 10; p++) {
+            if (sig < SNO_NUM_MANT_DIGITS) {
+                mant = mant * 10 + (unsigned)(*p - '0');
+                if (mant) sig++;
+                exp10--;
+            }
+            else if (*p != '0') exact = false;
+        }
+        digits += (unsigned)(p - frac);
+        if (!digits) return false;                             /* "." alone */
+    }
+    if (!digits) return false;
+    mend = p;
+
+    /* Exponent: only when digits follow the marker */
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        cstr_t* q = p + 1;
+        bool eneg = q < end && *q == '-';
+        long e = 0;
+        if (q < end && (eneg || *q == '+')) q++;
+        if (q < end && (unsigned)(*q - '0') < 10) {
+            for (; q < end && (unsigned)(*q - '0') < 10; q++) {
+                if (e < 100000) e = e * 10 + (*q - '0');       /* saturate: strtod reports range */
+            }
+            lexp = eneg ? -e : e;
+            exp10 += lexp;
+            p = q;
+        }
+    }
+
+    if (exact && mant < (1ull << 53) && exp10 >= -22 && exp10 <= 22) {
+        d = (double)mant;                                      /* exact, so one rounding below */
+        d = exp10 < 0 ? d / sno_pow10[-exp10] : d * sno_pow10[exp10];
+    }
+    else if (!sno_num_strtod(mstart, mend, lexp, &d)) {
+        return false;                                          /* overflow */
+    }
+    *out = neg ? -d : d;
+    return sno_num_take(s, start, p);
+}
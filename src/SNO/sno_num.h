@@ -0,0 +1,53 @@
+/* sno_num.h — Numeric primitives: recognize and convert in one scan */
+
+#ifndef SNO_NUM_H
+#define SNO_NUM_H
+
+#include "sno.h"
+#include <stdint.h>
+
+/**
+ * @file sno_num.h
+ * @brief sno_uint, sno_int, sno_hex, sno_float: match a number at the cursor and return its value
+ *
+ * Each primitive is greedy like sno_span: it takes every character of the
+ * number at the cursor and converts while it scans, instead of sno_span +
+ * sno_var + strtol (three passes and a copy). On success the view spans the
+ * number's text and *out holds its value; on no number, overflow or a NULL
+ * argument it fails with the cursor unchanged.
+ *
+ * Host builds on 64-bit little-endian targets check and convert eight
+ * decimal digits per step (SWAR: one word load, two mask tests, three
+ * multiplies); other targets and SNO_NO_SIMD use the digit loop.
+ */
+
+/*
+ * Significant digits sno_float hands to strtod when the exact fast path does
+ * not apply. 768 is the longest exact expansion of a point halfway between
+ * two doubles, so any later digits can only break a tie; fewer digits
+ * misround long halfway literals.
+ */
+#ifndef SNO_NUM_FLOAT_DIGITS
+#define SNO_NUM_FLOAT_DIGITS 768
+#endif
+
+/** Decimal digits (SNO_DIGITS)+ → uint32_t */
+bool sno_uint(sno_subject_t* s, uint32_t* out);
+
+/** Optional '+' or '-', then decimal digits+ → int64_t (INT64_MIN allowed) */
+bool sno_int(sno_subject_t* s, int64_t* out);
+
+/** Hex digits (SNO_HEX_DIGITS)+ → uint32_t; no "0x" prefix (match it with sno_lit first) */
+bool sno_hex(sno_subject_t* s, uint32_t* out);
+
+/**
+ * [+-] digits [. digits] [(e|E) [+-] digits] with at least one mantissa digit
+ * (".5" and "5." match, "." does not) → double. An exponent marker not
+ * followed by digits is left unconsumed. No inf/nan; values beyond the double
+ * range fail (underflow rounds toward zero as strtod does). There is no length
+ * limit: leading zeros are skipped, and digits past SNO_NUM_FLOAT_DIGITS only
+ * decide the rounding direction.
+ */
+bool sno_float(sno_subject_t* s, double* out);
+
+#endif
@@ -0,0 +1,133 @@
+#include "sno_num_test.h"
+#include "sno_constants.h"
+#include "sno_str.h"
+#include <assert.h>
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+void sno_num_test()
+{
+    sno_subject_t s = {0};
+    uint32_t u;
+    int64_t i;
+    double d;
+
+    /* sno_uint: greedy digits, view on the digits */
+    sno_bind(&s, "1290 SEP.");
+    assert(sno_uint(&s, &u) && u == 1290);
+    assert(s.view.begin == s.str.begin && s.view.end == s.str.begin + 4);
+    assert(!sno_uint(&s, &u) && s.view.end == s.str.begin + 4);   /* no digits: cursor unchanged */
+
+    /* Limits and overflow (long runs take the 8-digit path on hosts) */
+    sno_bind(&s, "4294967295");
+    assert(sno_uint(&s, &u) && u == 4294967295u && sno_at_r(&s, 0));
+    sno_bind(&s, "4294967296");
+    assert(!sno_uint(&s, &u) && s.view.end == s.str.begin);
+    sno_bind(&s, "00000000000000000000012345678x");
+    assert(sno_uint(&s, &u) && u == 12345678 && *s.view.end == 'x');
+    sno_bind(&s, "12345678");
+    assert(sno_uint(&s, &u) && u == 12345678 && sno_at_r(&s, 0));
+    sno_bind(&s, "1234567/");                                /* '/' sits just below '0' */
+    assert(sno_uint(&s, &u) && u == 1234567 && *s.view.end == '/');
+    sno_bind(&s, "1234567:");                                /* ':' just above '9' */
+    assert(sno_uint(&s, &u) && u == 1234567 && *s.view.end == ':');
+    sno_bind(&s, "-1");
+    assert(!sno_uint(&s, &u));
+
+    /* sno_int: optional sign, 64-bit range */
+    sno_bind(&s, "-42,+7,9223372036854775807,-9223372036854775808,9223372036854775808");
+    assert(sno_int(&s, &i) && i == -42 && sno_view_size(s.view) == 3);
+    assert(sno_ch(&s, ',') && sno_int(&s, &i) && i == 7);
+    assert(sno_ch(&s, ',') && sno_int(&s, &i) && i == INT64_MAX);
+    assert(sno_ch(&s, ',') && sno_int(&s, &i) && i == INT64_MIN);
+    assert(sno_ch(&s, ','));
+    {
+        cstr_t* at = s.view.end;
+        assert(!sno_int(&s, &i) && s.view.end == at);         /* overflow: cursor unchanged */
+    }
+    sno_bind(&s, "-x");
+    assert(!sno_int(&s, &i) && s.view.end == s.str.begin);  /* sign only */
+
+    /* sno_hex: pairs with SNO_HEX_DIGITS; prefix matched separately */
+    sno_bind(&s, "0x1F;DEADBEEF;100000000");
+    assert(sno_lit(&s, "0x") && sno_hex(&s, &u) && u == 0x1F);
+    assert(sno_ch(&s, ';') && sno_hex(&s, &u) && u == 0xDEADBEEFu);
+    assert(sno_ch(&s, ';') && !sno_hex(&s, &u));               /* 33 bits */
+    sno_bind(&s, "g");
+    assert(!sno_hex(&s, &u));
+
+    /* sno_float: fast path and strtod fallback agree with literals */
+    sno_bind(&s, "3.25 -0.5 .5 5. 1e3 2.5E-3 1e 12345678901234567890.5 1e400 -0");
+    assert(sno_float(&s, &d) && d == 3.25);
+    assert(sno_ch(&s, ' ') && sno_float(&s, &d) && d == -0.5);
+    assert(sno_ch(&s, ' ') && sno_float(&s, &d) && d == 0.5);
+    assert(sno_ch(&s, ' ') && sno_float(&s, &d) && d == 5.0 && sno_view_size(s.view) == 2);
+    assert(sno_ch(&s, ' ') && sno_float(&s, &d) && d == 1000.0);
+    assert(sno_ch(&s, ' ') && sno_float(&s, &d) && d == 2.5e-3);
+    assert(sno_ch(&s, ' ') && sno_float(&s, &d) && d == 1.0 && *s.view.end == 'e');  /* bare marker left */
+    assert(sno_len(&s, 1) && sno_ch(&s, ' '));
+    assert(sno_float(&s, &d) && d == 12345678901234567890.5);
+    assert(sno_ch(&s, ' '));
+    {
+        cstr_t* at = s.view.end;
+        assert(!sno_float(&s, &d) && s.view.end == at);       /* out of range */
+        assert(sno_len(&s, 5) && sno_ch(&s, ' '));
+    }
+    assert(sno_float(&s, &d) && d == 0.0 && signbit(d));
+    sno_bind(&s, ".");
+    assert(!sno_float(&s, &d));
+    sno_bind(&s, "-.e5");
+    assert(!sno_float(&s, &d));
+
+    /* Long literals: no length limit; digits past SNO_NUM_FLOAT_DIGITS only round */
+    {
+        static char lit[1024];
+        static const char* const longs[] = {
+            "0.00000000000000000000000000000000000000000000000000000000000000000000000015",
+            "1234567890123456789012345678901234567890123456789012345678901234567890.25e-30",
+            "00000000000000000000000000000000000000000000000000000000000000000000000000042.5",
+            "-2.2250738585072013830902327173324040642192159804623318305533274168872044348e-308",
+        };
+        size_t k;
+        for (k = 0; k < sizeof(longs) / sizeof(longs[0]); k++) {
+            sno_bind(&s, longs[k]);
+            assert(sno_float(&s, &d) && d == strtod(longs[k], NULL) && sno_at_r(&s, 0));
+        }
+        /* 2^53 + 1 is halfway: ties to even, any later nonzero digit rounds up */
+        strcpy(lit, "9007199254740993.");
+        memset(lit + 17, '0', 60);
+        strcpy(lit + 77, "1");
+        sno_bind(&s, lit);
+        assert(sno_float(&s, &d) && d == 9007199254740994.0 && sno_view_size(s.view) == 78);
+        lit[77] = '\0';
+        sno_bind(&s, lit);
+        assert(sno_float(&s, &d) && d == 9007199254740992.0);
+        /* Exact halfway points longer than a short digit buffer: 59 and 768 digits */
+        sno_bind(&s, "0.007812500000000002602085213965210641617886722087860107421875");
+        assert(sno_float(&s, &d) && d == ldexp(9007199254740996.0, -60));
+        strcpy(lit,
+            "2.2250738585072011360574097967091319759348195463516456480234261097248222220210769455165295"
+            "239081350879141491589130396211068700864386945946455276572074078206217433799881410632673292"
+            "535522868813721490129811224514518898490572223072852551331557550159143974763979834118019993"
+            "239625482890171070818506906306666559949382757725720157630626906633326475653000092458883164"
+            "330377797918696120494973903778297049050510806099407302629371289589500035837999672072543043"
+            "602840788957717961509455167482434710307026091446215722898802581825451803257070188608721131"
+            "280795122334262883686223215037756666225039825343359745688844239002654981983854879482922068"
+            "947216898310996983658468140228542433306603398508864458040010349339704275671864433837704860"
+            "3786162277173854562306587467901408672332763671875e-308");
+        sno_bind(&s, lit);                                       /* (2^53 - 1) * 2^-1075: ties to DBL_MIN */
+        assert(sno_float(&s, &d) && d == DBL_MIN && sno_at_r(&s, 0) && d == strtod(lit, NULL));
+        strcpy(strchr(lit, 'e') - 1, "4e-308");                  /* just below halfway */
+        sno_bind(&s, lit);
+        assert(sno_float(&s, &d) && d == DBL_MIN - ldexp(1.0, -1074) && d == strtod(lit, NULL));
+        memset(lit, '9', 400);                                   /* overflow at any length */
+        lit[400] = '\0';
+        sno_bind(&s, lit);
+        assert(!sno_float(&s, &d) && s.view.end == s.str.begin);
+    }
+
+    /* NULL guards */
+    assert(!sno_uint(NULL, &u) && !sno_int(&s, NULL) && !sno_hex(NULL, &u) && !sno_float(&s, NULL));
+}
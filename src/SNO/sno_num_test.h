@@ -0,0 +1,9 @@
+#ifndef SNO_NUM_TEST_H
+#define SNO_NUM_TEST_H
+
+#include "sno_num.h"
+#include <stdio.h>
+
+void sno_num_test();
+
+#endif
@@ -0,0 +1,92 @@
+#include "sno_parallel.h"
+#include "sno_lines.h"
+#include <string.h>
+
+#if !defined(SNO_NO_THREADS) && (defined(__unix__) || defined(__APPLE__))
+#define SNO_PTHREADS
+#include <pthread.h>
+#endif
+
+/* === Internal Helpers === */
+
+/* One worker's share: a record-aligned chunk and its context */
+typedef struct {
+    cstr_t* begin;
+    cstr_t* end;
+    char delim;
+    sno_record_fn fn;
+    void* ctx;
+    size_t matches;
+} sno_chunk_t;
+
+/* Match every record of one chunk */
+static void* sno_chunk_run(void* arg)
+{
+    sno_chunk_t* c = (sno_chunk_t*)arg;
+    sno_subject_t s, rec;
+    sno_lines_t it;
+
+    sno_bind_n(&s, c->begin, (size_t)(c->end - c->begin));
+    sno_records(&it, &s, c->delim);
+    while (sno_lines_next(&it, &rec)) {
+        if (c->fn(&rec, c->ctx)) c->matches++;
+    }
+    return NULL;
+}
+
+/* First record start at or after pos: just past the next delimiter (or end) */
+static cstr_t* sno_chunk_align(cstr_t* pos, cstr_t* begin, cstr_t* end, char delim)
+{
+    cstr_t* hit;
+    if (pos == begin || pos[-1] == delim) return pos;
+    hit = (cstr_t*)memchr(pos, delim, (size_t)(end - pos));
+    return hit ? hit + 1 : end;
+}
+
+/* === Driver === */
+
+size_t sno_parallel_records(cstr_t* buf, size_t len, char delim, sno_record_fn fn,
+                            void* ctx, size_t ctx_size, size_t nthreads)
+{
+    sno_chunk_t chunk[SNO_THREADS_MAX];
+    cstr_t* end;
+    cstr_t* pos;
+    size_t i, total = 0;
+#ifdef SNO_PTHREADS
+    pthread_t tid[SNO_THREADS_MAX];
+    bool started[SNO_THREADS_MAX];
+#endif
+
+    if (!buf || !fn || (!ctx && ctx_size)) return 0;
+    if (nthreads == 0) nthreads = 1;
+    if (nthreads > SNO_THREADS_MAX) nthreads = SNO_THREADS_MAX;
+
+    end = buf + len;
+    pos = buf;
+    for (i = 0; i < nthreads; i++) {
+        chunk[i].begin = pos;
+        pos = i + 1 < nthreads ? sno_chunk_align(buf + len / nthreads * (i + 1), buf, end, delim) : end;
+        if (pos < chunk[i].begin) pos = chunk[i].begin;      /* long record spanned the split */
+        chunk[i].end = pos;
+        chunk[i].delim = delim;
+        chunk[i].fn = fn;
+        chunk[i].ctx = ctx ? (char*)ctx + i * ctx_size : NULL;
+        chunk[i].matches = 0;
+    }
+
+#ifdef SNO_PTHREADS
+    for (i = 1; i < nthreads; i++) {                       /* calling thread takes chunk 0 */
+        started[i] = pthread_create(&tid[i], NULL, sno_chunk_run, &chunk[i]) == 0;
+    }
+    sno_chunk_run(&chunk[0]);
+    for (i = 1; i < nthreads; i++) {
+        if (started[i]) pthread_join(tid[i], NULL);
+        else sno_chunk_run(&chunk[i]);                     /* no thread: run inline */
+    }
+#else
+    for (i = 0; i < nthreads; i++) sno_chunk_run(&chunk[i]);
+#endif
+
+    for (i = 0; i < nthreads; i++) total += chunk[i].matches;
+    return total;
+}
@@ -0,0 +1,37 @@
+/* sno_parallel.h — Data-parallel record matching for host builds */
+
+#ifndef SNO_PARALLEL_H
+#define SNO_PARALLEL_H
+
+#include "sno.h"
+
+/**
+ * @file sno_parallel.h
+ * @brief Split a buffer at record boundaries and match chunks on worker threads
+ *
+ * Subjects hold only pointers into immutable input, so chunks parse
+ * independently. Chunk i (in buffer order) is handled by one worker using the
+ * i-th context, ctx + i * ctx_size; merging contexts 0..n-1 in index order
+ * therefore merges results in input order.
+ *
+ * POSIX hosts use pthreads (link with -pthread). The DOS target, and any build
+ * defining SNO_NO_THREADS, runs the same chunks serially with identical results.
+ */
+
+#ifndef SNO_THREADS_MAX
+#define SNO_THREADS_MAX 64   /* Upper bound on chunks/workers */
+#endif
+
+/** Per-record callback; return true when the record matched */
+typedef bool (*sno_record_fn)(sno_subject_t* rec, void* ctx);
+
+/**
+ * Run fn over every delim-separated record of buf[0..len) (records as yielded by
+ * sno_records) using up to nthreads chunks. ctx points to an array of nthreads
+ * contexts of ctx_size bytes each (ctx may be NULL when ctx_size is 0).
+ * Returns the number of records for which fn returned true.
+ */
+size_t sno_parallel_records(cstr_t* buf, size_t len, char delim, sno_record_fn fn,
+                            void* ctx, size_t ctx_size, size_t nthreads);
+
+#endif
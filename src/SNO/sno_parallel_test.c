@@ -0,0 +1,66 @@
+#include "sno_parallel_test.h"
+#include "sno_constants.h"
+#include "sno_str.h"
+#include <assert.h>
+#include <string.h>
+
+/* Per-thread results: records seen, first record number, sum of values */
+typedef struct {
+    size_t seen;
+    uint32_t first, sum;
+} tally_t;
+
+/* "ERROR <n>" records match; every record is "<LEVEL> <n>" */
+static bool tally_errors(sno_subject_t* rec, void* ctx)
+{
+    tally_t* t = (tally_t*)ctx;
+    uint32_t n = 0;
+    bool err = sno_lit(rec, "ERROR");
+    sno_break(rec, SNO_DIGITS);
+    if (sno_rem(rec)) sno_view_to_u32(rec->view, &n);
+    if (t->seen++ == 0) t->first = n;
+    if (err) t->sum += n;
+    return err;
+}
+
+void sno_parallel_test(void) {
+    static char log[4096];
+    tally_t t[SNO_THREADS_MAX];
+    size_t len = 0, i, k, total, seen;
+    uint32_t sum, prev;
+    size_t threads[] = {1, 2, 3, 7, 64, 100};
+
+    for (i = 0; i < 200; i++) {
+        len += (size_t)sprintf(log + len, "%s %lu\n", i % 3 ? "INFO" : "ERROR", (unsigned long)i);
+    }
+
+    /* Same answer at any thread count; contexts merge in input order */
+    for (k = 0; k < sizeof(threads) / sizeof(threads[0]); k++) {
+        memset(t, 0, sizeof(t));
+        total = sno_parallel_records(log, len, '\n', tally_errors, t, sizeof(tally_t), threads[k]);
+        assert(total == 67);
+        seen = 0, sum = 0, prev = 0;
+        for (i = 0; i < SNO_THREADS_MAX; i++) {
+            if (!t[i].seen) continue;
+            assert(seen == 0 || t[i].first > prev);            /* chunk order = input order */
+            assert(t[i].first == seen);                        /* no record split or lost */
+            prev = t[i].first;
+            seen += t[i].seen;
+            sum += t[i].sum;
+        }
+        assert(seen == 200 && sum == 3 * (66 * 67 / 2));
+    }
+
+    /* Final record without delimiter, record longer than a chunk */
+    memset(t, 0, sizeof(t));
+    strcpy(log, "ERROR 1\nINFO 2222222222222222222222222\nERROR 3");
+    total = sno_parallel_records(log, strlen(log), '\n', tally_errors, t, sizeof(tally_t), 8);
+    for (i = 0, sum = 0, seen = 0; i < 8; i++) sum += t[i].sum, seen += t[i].seen;
+    assert(total == 2 && sum == 4 && seen == 3);
+
+    /* Empty buffer, NULL guards */
+    assert(sno_parallel_records("", 0, '\n', tally_errors, t, sizeof(tally_t), 4) == 0);
+    assert(sno_parallel_records(NULL, 0, '\n', tally_errors, t, sizeof(tally_t), 4) == 0);
+    assert(sno_parallel_records(log, len, '\n', NULL, t, sizeof(tally_t), 4) == 0);
+    assert(sno_parallel_records(log, len, '\n', tally_errors, NULL, sizeof(tally_t), 4) == 0);
+}
@@ -0,0 +1,9 @@
+#ifndef SNO_PARALLEL_TEST_H
+#define SNO_PARALLEL_TEST_H
+
+#include "sno_parallel.h"
+#include <stdio.h>
+
+void sno_parallel_test();
+
+#endif
@@ -0,0 +1,359 @@
+#include "sno_pat.h"
+#include <string.h>
+
+/* === Internal Helpers === */
+
+/* Opcodes; operands follow inline (u16/u32 little-endian, csets 32 bytes) */
+enum {
+    OP_END,      /* success */
+    OP_CH,       /* c */
+    OP_LIT,      /* n, bytes[n] */
+    OP_LEN,      /* u32 */
+    OP_TAB,      /* u32 */
+    OP_RTAB,     /* u32 */
+    OP_REM,
+    OP_ANY,      /* cset */
+    OP_NOTANY,   /* cset */
+    OP_SPAN,     /* cset */
+    OP_BREAK,    /* cset */
+    OP_BAL,      /* open, close */
+    OP_MARK,
+    OP_MARK_N,   /* slot */
+    OP_CAP_N,    /* slot */
+    OP_CHOICE,   /* u16 next alternative */
+    OP_COMMIT,   /* u16 end of alternation (patch chain while building) */
+    OP_FAIL
+};
+
+#define sno_rd16(b) ((size_t)(b)[0] | (size_t)(b)[1] << 8)
+#define sno_rd32(b) ((size_t)((unsigned long)(b)[0] | (unsigned long)(b)[1] << 8 | \
+                              (unsigned long)(b)[2] << 16 | (unsigned long)(b)[3] << 24))
+
+static void sno_wr16(unsigned char* b, size_t v)
+{
+    b[0] = (unsigned char)v;
+    b[1] = (unsigned char)(v >> 8);
+}
+
+static void sno_wr32(unsigned char* b, unsigned long v)
+{
+    b[0] = (unsigned char)v;
+    b[1] = (unsigned char)(v >> 8);
+    b[2] = (unsigned char)(v >> 16);
+    b[3] = (unsigned char)(v >> 24);
+}
+
+/* Bytes occupied by instruction at ip, operands included */
+static size_t sno_pat_step(const unsigned char* ip)
+{
+    switch (*ip) {
+    case OP_CH: case OP_MARK_N: case OP_CAP_N: return 2;
+    case OP_LIT: return 2 + (size_t)ip[1];
+    case OP_LEN: case OP_TAB: case OP_RTAB: return 5;
+    case OP_ANY: case OP_NOTANY: case OP_SPAN: case OP_BREAK: return 33;
+    case OP_BAL: case OP_CHOICE: case OP_COMMIT: return 3;
+    default: return 1;
+    }
+}
+
+/* Append opcode plus n operand bytes; returns operand area or NULL (p->ok cleared) */
+static unsigned char* sno_pat_emit(sno_pat_t* p, unsigned char op, size_t n)
+{
+    unsigned char* at;
+    if (!p) return NULL;
+    if (!p->ok || p->done || n + 1 > p->size - p->len || p->len + n + 1 > SNO_PAT_MAX) {
+        p->ok = false;
+        return NULL;
+    }
+    at = p->code + p->len;
+    *at = op;
+    p->len += n + 1;
+    return at + 1;
+}
+
+static void sno_pat_u32(sno_pat_t* p, unsigned char op, size_t n)
+{
+    unsigned char* at = sno_pat_emit(p, op, 4);
+    if (at) sno_wr32(at, (unsigned long)n);
+}
+
+static void sno_pat_cs(sno_pat_t* p, unsigned char op, const sno_cset_t* cs)
+{
+    unsigned char* at;
+    if (!cs) {
+        if (p) p->ok = false;
+        return;
+    }
+    at = sno_pat_emit(p, op, sizeof(cs->bits));
+    if (at) memcpy(at, cs->bits, sizeof(cs->bits));
+}
+
+static void sno_pat_set(sno_pat_t* p, unsigned char op, const char* set)
+{
+    sno_cset_t cs;
+    if (!set) {
+        if (p) p->ok = false;
+        return;
+    }
+    sno_cset(&cs, set);
+    sno_pat_cs(p, op, &cs);
+}
+
+/* Push a CHOICE for the current level; target patched by or/end */
+static void sno_pat_choice(sno_pat_t* p)
+{
+    if (sno_pat_emit(p, OP_CHOICE, 2)) p->choice[p->depth - 1] = p->len - 2;
+}
+
+/* Append COMMIT linked into this level's patch chain */
+static void sno_pat_commit(sno_pat_t* p)
+{
+    unsigned char* at = sno_pat_emit(p, OP_COMMIT, 2);
+    if (at) {
+        sno_wr16(at, p->commit[p->depth - 1]);
+        p->commit[p->depth - 1] = p->len - 2;
+    }
+}
+
+/* === Building === */
+
+void sno_pat(sno_pat_t* p, unsigned char* code, size_t size)
+{
+    if (!p) return;
+    p->code = code;
+    p->size = code ? size : 0;
+    p->len = 0;
+    p->depth = 0;
+    p->ok = code != NULL;
+    p->done = false;
+}
+
+void sno_pat_ch(sno_pat_t* p, char c)
+{
+    unsigned char* at = sno_pat_emit(p, OP_CH, 1);
+    if (at) *at = (unsigned char)c;
+}
+
+void sno_pat_lit(sno_pat_t* p, const char* lit)
+{
+    size_t n;
+    unsigned char* at;
+    if (!lit || (n = strlen(lit)) > 255) {
+        if (p) p->ok = false;
+        return;
+    }
+    at = sno_pat_emit(p, OP_LIT, n + 1);
+    if (at) {
+        *at = (unsigned char)n;
+        memcpy(at + 1, lit, n);
+    }
+}
+
+void sno_pat_len(sno_pat_t* p, size_t n)  { sno_pat_u32(p, OP_LEN, n); }
+void sno_pat_tab(sno_pat_t* p, size_t n)  { sno_pat_u32(p, OP_TAB, n); }
+void sno_pat_rtab(sno_pat_t* p, size_t n) { sno_pat_u32(p, OP_RTAB, n); }
+void sno_pat_rem(sno_pat_t* p)            { sno_pat_emit(p, OP_REM, 0); }
+
+void sno_pat_any(sno_pat_t* p, const char* set)    { sno_pat_set(p, OP_ANY, set); }
+void sno_pat_notany(sno_pat_t* p, const char* set) { sno_pat_set(p, OP_NOTANY, set); }
+void sno_pat_span(sno_pat_t* p, const char* set)   { sno_pat_set(p, OP_SPAN, set); }
+void sno_pat_break(sno_pat_t* p, const char* set)  { sno_pat_set(p, OP_BREAK, set); }
+
+void sno_pat_any_cset(sno_pat_t* p, const sno_cset_t* cs)    { sno_pat_cs(p, OP_ANY, cs); }
+void sno_pat_notany_cset(sno_pat_t* p, const sno_cset_t* cs) { sno_pat_cs(p, OP_NOTANY, cs); }
+void sno_pat_span_cset(sno_pat_t* p, const sno_cset_t* cs)   { sno_pat_cs(p, OP_SPAN, cs); }
+void sno_pat_break_cset(sno_pat_t* p, const sno_cset_t* cs)  { sno_pat_cs(p, OP_BREAK, cs); }
+
+void sno_pat_bal(sno_pat_t* p, char open, char close)
+{
+    unsigned char* at = sno_pat_emit(p, OP_BAL, 2);
+    if (at) {
+        at[0] = (unsigned char)open;
+        at[1] = (unsigned char)close;
+    }
+}
+
+void sno_pat_mark(sno_pat_t* p) { sno_pat_emit(p, OP_MARK, 0); }
+
+void sno_pat_mark_n(sno_pat_t* p, size_t i)
+{
+    unsigned char* at = i < SNO_CAPS ? sno_pat_emit(p, OP_MARK_N, 1) : NULL;
+    if (at) *at = (unsigned char)i;
+    else if (p) p->ok = false;
+}
+
+void sno_pat_cap_n(sno_pat_t* p, size_t i)
+{
+    unsigned char* at = i < SNO_CAPS ? sno_pat_emit(p, OP_CAP_N, 1) : NULL;
+    if (at) *at = (unsigned char)i;
+    else if (p) p->ok = false;
+}
+
+/*
+ * Layout of alt A or B or C end:
+ *   CHOICE L1  A  COMMIT E
+ *   L1: CHOICE L2  B  COMMIT E
+ *   L2: CHOICE L3  C  COMMIT E
+ *   L3: FAIL
+ *   E:
+ */
+void sno_pat_alt(sno_pat_t* p)
+{
+    if (!p) return;
+    if (p->depth == SNO_PAT_DEPTH) {
+        p->ok = false;
+        return;
+    }
+    p->commit[p->depth++] = 0;
+    sno_pat_choice(p);
+}
+
+void sno_pat_or(sno_pat_t* p)
+{
+    if (!p) return;
+    if (p->depth == 0) {
+        p->ok = false;
+        return;
+    }
+    sno_pat_commit(p);
+    if (p->ok) sno_wr16(p->code + p->choice[p->depth - 1], p->len);
+    sno_pat_choice(p);
+}
+
+void sno_pat_end(sno_pat_t* p)
+{
+    size_t site, next;
+    if (!p) return;
+    if (p->depth == 0) {
+        p->ok = false;
+        return;
+    }
+    sno_pat_commit(p);
+    if (p->ok) sno_wr16(p->code + p->choice[p->depth - 1], p->len);
+    sno_pat_emit(p, OP_FAIL, 0);
+    if (p->ok) {
+        for (site = p->commit[p->depth - 1]; site; site = next) {
+            next = sno_rd16(p->code + site);
+            sno_wr16(p->code + site, p->len);
+        }
+    }
+    p->depth--;
+}
+
+bool sno_pat_done(sno_pat_t* p)
+{
+    if (!p) return false;
+    if (p->depth) p->ok = false;
+    sno_pat_emit(p, OP_END, 0);
+    p->done = p->ok;
+    return p->ok;
+}
+
+/* === Inspection === */
+
+bool sno_pat_anchor(const sno_pat_t* p, sno_view_t* lit)
+{
+    const unsigned char* ip;
+    const unsigned char* end;
+    size_t depth = 0, best = 0;
+    if (!p || !p->done || !lit) return false;
+    end = p->code + p->len;
+    for (ip = p->code; ip < end; ip += sno_pat_step(ip)) {
+        if (*ip == OP_CHOICE) depth++;
+        else if (*ip == OP_COMMIT) depth--;
+        else if (depth == 0 && *ip == OP_CH && best < 1) {
+            best = 1;
+            lit->begin = (cstr_t*)ip + 1;
+        }
+        else if (depth == 0 && *ip == OP_LIT && ip[1] > best) {
+            best = ip[1];
+            lit->begin = (cstr_t*)ip + 2;
+        }
+    }
+    if (best) lit->end = lit->begin + best;
+    return best > 0;
+}
+
+/* === Matching === */
+
+bool sno_match(sno_subject_t* s, const sno_pat_t* p)
+{
+    struct {
+        cstr_t* pos;
+        cstr_t* mark;
+        size_t alt;
+        sno_view_t caps[SNO_CAPS];                   /* slots as they were at the CHOICE */
+    } stack[SNO_PAT_DEPTH];
+    sno_view_t view, caps[SNO_CAPS];
+    cstr_t* mark;
+    const unsigned char* code;
+    const unsigned char* ip;
+    size_t sp = 0, pc = 0, n;
+    bool ok;
+
+    if (!s || !p || !p->done) return false;
+    view = s->view;
+    mark = s->mark;
+    memcpy(caps, s->caps, sizeof(caps));
+    code = p->code;
+
+    for (;;) {
+        ip = code + pc;
+        switch (*ip) {
+        case OP_END:
+            s->view.begin = view.end;
+            return true;
+        case OP_CH:
+            ok = sno_ch(s, (char)ip[1]);
+            pc += 2;
+            break;
+        case OP_LIT:
+            n = ip[1];
+            ok = (size_t)(s->str.end - s->view.end) >= n && memcmp(s->view.end, ip + 2, n) == 0;
+            if (ok) {
+                s->view.begin = s->view.end;
+                s->view.end += n;
+            }
+            pc += 2 + n;
+            break;
+        case OP_LEN:  ok = sno_len(s, sno_rd32(ip + 1));  pc += 5; break;
+        case OP_TAB:  ok = sno_tab(s, sno_rd32(ip + 1));  pc += 5; break;
+        case OP_RTAB: ok = sno_rtab(s, sno_rd32(ip + 1)); pc += 5; break;
+        case OP_REM:  ok = sno_rem(s); pc += 1; break;
+        case OP_ANY:    ok = sno_any_cset(s, (const sno_cset_t*)(ip + 1));    pc += 33; break;
+        case OP_NOTANY: ok = sno_notany_cset(s, (const sno_cset_t*)(ip + 1)); pc += 33; break;
+        case OP_SPAN:   ok = sno_span_cset(s, (const sno_cset_t*)(ip + 1));   pc += 33; break;
+        case OP_BREAK:  ok = sno_break_cset(s, (const sno_cset_t*)(ip + 1));  pc += 33; break;
+        case OP_BAL:    ok = sno_bal(s, (char)ip[1], (char)ip[2]); pc += 3; break;
+        case OP_MARK:   ok = sno_mark(s); pc += 1; break;
+        case OP_MARK_N: ok = sno_mark_n(s, ip[1]); pc += 2; break;
+        case OP_CAP_N:  ok = sno_cap_n(s, ip[1]); pc += 2; break;
+        case OP_CHOICE:
+            stack[sp].pos = s->view.end;
+            stack[sp].mark = s->mark;
+            memcpy(stack[sp].caps, s->caps, sizeof(caps));
+            stack[sp++].alt = sno_rd16(ip + 1);
+            pc += 3;
+            continue;
+        case OP_COMMIT:
+            sp--;
+            pc = sno_rd16(ip + 1);
+            continue;
+        default:                                     /* OP_FAIL */
+            ok = false;
+            break;
+        }
+        if (ok) continue;
+        if (sp == 0) {                               /* no alternative left: restore all */
+            s->view = view;
+            s->mark = mark;
+            memcpy(s->caps, caps, sizeof(caps));
+            return false;
+        }
+        sp--;                                        /* next alternative: restore the CHOICE state */
+        s->view.begin = s->view.end = stack[sp].pos;
+        s->mark = stack[sp].mark;
+        memcpy(s->caps, stack[sp].caps, sizeof(caps));
+        pc = stack[sp].alt;
+    }
+}
@@ -0,0 +1,109 @@
+/* sno_pat.h — Compiled patterns: flat bytecode and matcher */
+
+#ifndef SNO_PAT_H
+#define SNO_PAT_H
+
+#include "sno.h"
+
+/**
+ * @file sno_pat.h
+ * @brief Build runtime-loaded patterns into compact bytecode, run with sno_match
+ *
+ * A sno_pat_t is built into caller memory by appending elements in sequence;
+ * sno_pat_alt / sno_pat_or / sno_pat_end bracket an ordered alternation, which
+ * may nest up to SNO_PAT_DEPTH levels. Semantics are exactly those of the
+ * hand-written && / || composition: each primitive matches once, an alternative
+ * that succeeds is committed (never re-entered), and a failing alternative
+ * restores the cursor, mark and capture slots to their state at the
+ * alternation before the next one runs. No general backtracking, so matching
+ * stays linear in the subject for a given pattern.
+ *
+ * Builder calls never fail individually; overflow of the code buffer, a
+ * too-long literal or unbalanced nesting clears p->ok, and sno_pat_done()
+ * reports it once.
+ *
+ * @code
+ * // "GET " or "PUT ", then a path up to a space
+ * sno_pat_t p;
+ * unsigned char code[128];
+ * sno_pat(&p, code, sizeof(code));
+ * sno_pat_alt(&p); sno_pat_lit(&p, "GET "); sno_pat_or(&p); sno_pat_lit(&p, "PUT "); sno_pat_end(&p);
+ * sno_pat_mark_n(&p, 0); sno_pat_break(&p, " "); sno_pat_cap_n(&p, 0);
+ * if (sno_pat_done(&p) && sno_match(&s, &p)) ...
+ * @endcode
+ */
+
+#ifndef SNO_PAT_DEPTH
+#define SNO_PAT_DEPTH 16   /* Max alternation nesting (choice stack depth) */
+#endif
+
+#define SNO_PAT_MAX 0xFFFFu   /* Max code bytes: jump targets are 16-bit */
+
+typedef struct {
+    unsigned char* code;          /**< Bytecode (caller-owned) */
+    size_t size;                  /**< Capacity of code */
+    size_t len;                   /**< Bytes emitted */
+    size_t depth;                 /**< Open alternations while building */
+    size_t choice[SNO_PAT_DEPTH]; /**< Per level: pending CHOICE operand site */
+    size_t commit[SNO_PAT_DEPTH]; /**< Per level: head of COMMIT patch chain (0 = none) */
+    bool ok;                      /**< False once any builder call failed */
+    bool done;                    /**< Terminated by sno_pat_done */
+} sno_pat_t;
+
+/* Name from the original proposal; sno_pat_t matches the sno_pat() builder prefix */
+typedef sno_pat_t sno_pattern_t;
+
+/* === Building === */
+
+/** Start building into code[0..size) */
+void sno_pat(sno_pat_t* p, unsigned char* code, size_t size);
+
+void sno_pat_ch(sno_pat_t* p, char c);
+void sno_pat_lit(sno_pat_t* p, const char* lit);      /**< ≤ 255 chars */
+void sno_pat_len(sno_pat_t* p, size_t n);
+void sno_pat_tab(sno_pat_t* p, size_t n);
+void sno_pat_rtab(sno_pat_t* p, size_t n);
+void sno_pat_rem(sno_pat_t* p);
+
+void sno_pat_any(sno_pat_t* p, const char* set);
+void sno_pat_notany(sno_pat_t* p, const char* set);
+void sno_pat_span(sno_pat_t* p, const char* set);
+void sno_pat_break(sno_pat_t* p, const char* set);
+void sno_pat_any_cset(sno_pat_t* p, const sno_cset_t* cs);
+void sno_pat_notany_cset(sno_pat_t* p, const sno_cset_t* cs);
+void sno_pat_span_cset(sno_pat_t* p, const sno_cset_t* cs);
+void sno_pat_break_cset(sno_pat_t* p, const sno_cset_t* cs);
+
+void sno_pat_bal(sno_pat_t* p, char open, char close);
+
+void sno_pat_mark(sno_pat_t* p);
+void sno_pat_mark_n(sno_pat_t* p, size_t i);
+void sno_pat_cap_n(sno_pat_t* p, size_t i);
+
+/** Begin ordered alternation; first alternative follows */
+void sno_pat_alt(sno_pat_t* p);
+/** End current alternative, begin the next */
+void sno_pat_or(sno_pat_t* p);
+/** End alternation */
+void sno_pat_end(sno_pat_t* p);
+
+/** Terminate pattern; true when every builder call succeeded */
+bool sno_pat_done(sno_pat_t* p);
+
+/* === Inspection === */
+
+/**
+ * Longest literal every match must consume (a top-level LIT or CH, outside any
+ * alternation). lit views into p->code; false when the pattern has none.
+ */
+bool sno_pat_anchor(const sno_pat_t* p, sno_view_t* lit);
+
+/* === Matching === */
+
+/**
+ * Run compiled pattern at cursor. On success view spans the whole match and
+ * cursor follows it; on failure cursor, view, mark and slots are unchanged.
+ */
+bool sno_match(sno_subject_t* s, const sno_pat_t* p);
+
+#endif
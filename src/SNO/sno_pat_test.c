@@ -0,0 +1,161 @@
+#include "sno_pat_test.h"
+#include "sno_constants.h"
+#include "sno_str.h"
+#include <assert.h>
+#include <string.h>
+
+void sno_pat_test(void) {
+    sno_subject_t s = {0};
+    sno_pat_t p;
+    unsigned char code[512];
+    sno_view_t v;
+    size_t i;
+
+    /* Sequence: identifier '=' digits, whole-match view */
+    sno_pat(&p, code, sizeof(code));
+    sno_pat_any_cset(&p, &SNO_CSET_LETTERS);
+    sno_pat_span(&p, SNO_ALNUM_U);
+    sno_pat_ch(&p, '=');
+    sno_pat_mark_n(&p, 0);
+    sno_pat_span_cset(&p, &SNO_CSET_DIGITS);
+    sno_pat_cap_n(&p, 0);
+    assert(sno_pat_done(&p));
+    sno_bind(&s, "port=8080;");
+    assert(sno_match(&s, &p));
+    assert(s.view.begin == s.str.begin && sno_view_size(s.view) == 9);
+    v = sno_cap_view_n(&s, 0);
+    assert(sno_view_eq(v, "8080"));
+    assert(sno_ch(&s, ';'));
+    sno_bind(&s, "port=x");
+    sno_mark(&s);
+    assert(!sno_match(&s, &p));                                     /* failure contract */
+    assert(s.view.end == s.str.begin && s.mark == s.str.begin && !s.caps[0].begin);
+
+    /* Ordered alternation with rollback between alternatives */
+    sno_pat(&p, code, sizeof(code));
+    sno_pat_alt(&p);
+    sno_pat_lit(&p, "GET "); sno_pat_lit(&p, "/admin");            /* fails after "GET " */
+    sno_pat_or(&p);
+    sno_pat_lit(&p, "GET ");
+    sno_pat_or(&p);
+    sno_pat_lit(&p, "PUT ");
+    sno_pat_end(&p);
+    sno_pat_mark_n(&p, 1);
+    sno_pat_break(&p, " ");
+    sno_pat_cap_n(&p, 1);
+    assert(sno_pat_done(&p));
+    sno_bind(&s, "GET /index.html HTTP/1.0");
+    assert(sno_match(&s, &p));
+    v = sno_cap_view_n(&s, 1);
+    assert(sno_view_eq(v, "/index.html"));
+    sno_bind(&s, "PUT /x HTTP/1.0");
+    assert(sno_match(&s, &p) && sno_view_eq(s.view, "PUT /x"));
+    sno_bind(&s, "GET /admin HTTP/1.0");
+    assert(sno_match(&s, &p) && sno_at(&s, 10));                   /* first alternative */
+    sno_bind(&s, "POST /x");
+    assert(!sno_match(&s, &p) && s.view.end == s.str.begin);
+
+    /* Committed alternative is not re-entered: (a | ab) c fails on "abc" */
+    sno_pat(&p, code, sizeof(code));
+    sno_pat_alt(&p); sno_pat_ch(&p, 'a'); sno_pat_or(&p); sno_pat_lit(&p, "ab"); sno_pat_end(&p);
+    sno_pat_ch(&p, 'c');
+    assert(sno_pat_done(&p));
+    sno_bind(&s, "abc");
+    assert(!sno_match(&s, &p));
+    sno_bind(&s, "ac");
+    assert(sno_match(&s, &p) && sno_at_r(&s, 0));
+
+    /* Nesting, slot rollback inside failed alternative, bal, positioning */
+    sno_pat(&p, code, sizeof(code));
+    sno_pat_alt(&p);
+    sno_pat_mark_n(&p, 2); sno_pat_span(&p, SNO_DIGITS); sno_pat_cap_n(&p, 2); sno_pat_ch(&p, '!');
+    sno_pat_or(&p);
+    sno_pat_alt(&p);
+    sno_pat_bal(&p, '(', ')');
+    sno_pat_or(&p);
+    sno_pat_notany(&p, "()"); sno_pat_len(&p, 2);
+    sno_pat_end(&p);
+    sno_pat_end(&p);
+    sno_pat_rtab(&p, 1); sno_pat_rem(&p);
+    assert(sno_pat_done(&p));
+    sno_bind(&s, "12!x");
+    assert(sno_match(&s, &p) && s.caps[2].begin);
+    sno_bind(&s, "12(");                                             /* digits then no '!' */
+    assert(!sno_match(&s, &p) && !s.caps[2].begin);
+    sno_bind(&s, "12(a)");                                           /* slot 2 dropped with alt 1 */
+    assert(sno_match(&s, &p) && !s.caps[2].begin);
+    sno_bind(&s, "(a(b))zz");
+    assert(sno_match(&s, &p) && sno_view_size(s.view) == 8 && !s.caps[2].begin);
+    sno_bind(&s, "xyzw");
+    assert(sno_match(&s, &p));
+    sno_bind(&s, "xyzw");
+    sno_pat(&p, code, sizeof(code));
+    sno_pat_tab(&p, 2); sno_pat_notany_cset(&p, &SNO_CSET_DIGITS); sno_pat_mark(&p); sno_pat_rem(&p);
+    assert(sno_pat_done(&p) && sno_match(&s, &p) && s.mark == s.str.begin + 3);
+
+    /* Failed alternatives restore the slots as they were at the alternation */
+    {
+        sno_subject_t h = {0}, save;
+        bool ok;
+
+        /* A slot opened just before the alternation survives a failed alternative */
+        sno_pat(&p, code, sizeof(code));
+        sno_pat_mark_n(&p, 0);
+        sno_pat_alt(&p); sno_pat_lit(&p, "x"); sno_pat_or(&p); sno_pat_lit(&p, "a"); sno_pat_end(&p);
+        sno_pat_cap_n(&p, 0);
+        assert(sno_pat_done(&p));
+        sno_bind(&h, "a");
+        ok = sno_mark_n(&h, 0) && (sno_lit(&h, "x") || sno_lit(&h, "a")) && sno_cap_n(&h, 0);
+        sno_bind(&s, "a");
+        assert(ok && sno_match(&s, &p));
+        assert(s.caps[0].begin == s.str.begin && sno_view_size(s.caps[0]) == 1);
+        assert(sno_view_size(h.caps[0]) == 1);
+
+        /* A slot closed before the alternation keeps that capture when a failed
+           alternative re-closes it */
+        sno_pat(&p, code, sizeof(code));
+        sno_pat_mark_n(&p, 0); sno_pat_lit(&p, "a"); sno_pat_cap_n(&p, 0);
+        sno_pat_alt(&p);
+        sno_pat_lit(&p, "b"); sno_pat_cap_n(&p, 0); sno_pat_lit(&p, "x");
+        sno_pat_or(&p);
+        sno_pat_lit(&p, "b");
+        sno_pat_end(&p);
+        assert(sno_pat_done(&p));
+        sno_bind(&h, "abc");
+        ok = sno_mark_n(&h, 0) && sno_lit(&h, "a") && sno_cap_n(&h, 0);
+        save = h;
+        ok = ok && ((sno_lit(&h, "b") && sno_cap_n(&h, 0) && sno_lit(&h, "x")) ||
+                    (h = save, sno_lit(&h, "b")));
+        sno_bind(&s, "abc");
+        assert(ok && sno_match(&s, &p) && sno_at(&s, 2) && sno_at(&h, 2));
+        assert(sno_view_eq(s.caps[0], "a") && sno_view_eq(h.caps[0], "a"));
+    }
+
+    /* Builder errors: overflow, unbalanced, too deep, too-long literal, use before done */
+    sno_pat(&p, code, 8);
+    sno_pat_span(&p, "abc");
+    assert(!sno_pat_done(&p) && !sno_match(&s, &p));
+    sno_pat(&p, code, sizeof(code));
+    sno_pat_alt(&p); sno_pat_ch(&p, 'a');
+    assert(!sno_pat_done(&p));
+    sno_pat(&p, code, sizeof(code));
+    sno_pat_or(&p);
+    assert(!sno_pat_done(&p));
+    sno_pat(&p, code, sizeof(code));
+    for (i = 0; i <= SNO_PAT_DEPTH; i++) sno_pat_alt(&p);
+    assert(!p.ok);
+    sno_pat(&p, code, sizeof(code));
+    {
+        char big[300];
+        memset(big, 'x', sizeof(big) - 1);
+        big[sizeof(big) - 1] = '\0';
+        sno_pat_lit(&p, big);
+        assert(!sno_pat_done(&p));
+    }
+    sno_pat(&p, code, sizeof(code));
+    sno_pat_ch(&p, 'x');
+    assert(!sno_match(&s, &p));                                     /* not terminated */
+    sno_pat_mark_n(&p, SNO_CAPS);
+    assert(!sno_pat_done(&p));
+    assert(!sno_match(NULL, &p) && !sno_match(&s, NULL));
+}
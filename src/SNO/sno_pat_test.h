@@ -0,0 +1,9 @@
+#ifndef SNO_PAT_TEST_H
+#define SNO_PAT_TEST_H
+
+#include "sno_pat.h"
+#include <stdio.h>
+
+void sno_pat_test();
+
+#endif
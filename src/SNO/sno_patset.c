@@ -0,0 +1,143 @@
+#include "sno_patset.h"
+#include <string.h>
+
+/* === Internal Helpers === */
+
+#define sno_bit_set(b, i) ((b)[(i) >> 3] |= (unsigned char)(1u << ((i) & 7)))
+#define sno_bit_get(b, i) (((b)[(i) >> 3] >> ((i) & 7)) & 1)
+
+/* Transition from node n on c, or 0 */
+static unsigned short sno_ac_edge(const sno_patset_t* ps, unsigned short n, unsigned char c)
+{
+    unsigned short k;
+    if (n == 0) return ps->root[c];
+    for (k = ps->nodes[n].child; k; k = ps->nodes[k].sibling) {
+        if (ps->nodes[k].c == c) return k;
+    }
+    return 0;
+}
+
+/* Insert anchor into trie; returns terminal node or 0 when nodes ran out */
+static unsigned short sno_ac_insert(sno_patset_t* ps, sno_view_t lit, size_t max_nodes)
+{
+    unsigned short n = 0, k;
+    cstr_t* p;
+    for (p = lit.begin; p < lit.end; p++) {
+        unsigned char c = (unsigned char)*p;
+        k = sno_ac_edge(ps, n, c);
+        if (!k) {
+            sno_patset_node_t* v;
+            if (ps->node_count == max_nodes || ps->node_count > 0xFFFFu) return 0;
+            k = (unsigned short)ps->node_count++;
+            v = &ps->nodes[k];
+            v->child = v->fail = v->dict = v->out = 0;
+            v->c = c;
+            v->depth = (unsigned char)(ps->nodes[n].depth + 1);
+            if (n == 0) {
+                v->sibling = 0;
+                ps->root[c] = k;
+            }
+            else {
+                v->sibling = ps->nodes[n].child;
+                ps->nodes[n].child = k;
+            }
+        }
+        n = k;
+    }
+    return n;
+}
+
+/* Fail and dict links, level by level (parents before children) */
+static void sno_ac_link(sno_patset_t* ps)
+{
+    sno_patset_node_t* nd = ps->nodes;
+    size_t u, d, more = 1;
+    unsigned short v, f, t;
+
+    for (d = 1; more; d++) {
+        more = 0;
+        for (u = 1; u < ps->node_count; u++) {
+            if (nd[u].depth != d) continue;
+            if (d == 1) nd[u].fail = 0;
+            for (v = nd[u].child; v; v = nd[v].sibling) {
+                more = 1;
+                f = nd[u].fail;
+                while ((t = sno_ac_edge(ps, f, nd[v].c)) == 0 && f != 0) f = nd[f].fail;
+                nd[v].fail = t;
+                nd[v].dict = nd[t].out ? t : nd[t].dict;
+            }
+        }
+    }
+}
+
+/* Run one rule on a private copy of s */
+static bool sno_patset_try(const sno_pat_t* rule, const sno_subject_t* s)
+{
+    sno_subject_t t = *s;
+    return sno_match(&t, rule);
+}
+
+/* === Building === */
+
+bool sno_patset(sno_patset_t* ps, const sno_pat_t* rules, size_t count,
+                sno_patset_node_t* nodes, size_t max_nodes)
+{
+    size_t i;
+    if (!ps || (!rules && count) || !nodes || max_nodes == 0 || count > SNO_PATSET_MAX) return false;
+    ps->rules = rules;
+    ps->count = count;
+    ps->nodes = nodes;
+    ps->node_count = 1;
+    memset(&nodes[0], 0, sizeof(nodes[0]));
+    memset(ps->root, 0, sizeof(ps->root));
+    ps->always = 0;
+
+    for (i = count; i-- > 0;) {                      /* reverse: output lists in rule order */
+        sno_view_t lit;
+        unsigned short n;
+        if (!rules[i].done) return false;
+        if (!sno_pat_anchor(&rules[i], &lit)) {
+            ps->next[i] = ps->always;
+            ps->always = (unsigned short)(i + 1);
+            continue;
+        }
+        if ((n = sno_ac_insert(ps, lit, max_nodes)) == 0) return false;
+        ps->next[i] = nodes[n].out;
+        nodes[n].out = (unsigned short)(i + 1);
+    }
+    sno_ac_link(ps);
+    return true;
+}
+
+/* === Matching === */
+
+size_t sno_patset_match(const sno_patset_t* ps, const sno_subject_t* s, unsigned char* hits)
+{
+    const sno_patset_node_t* nd;
+    cstr_t* p;
+    unsigned short state = 0, t, k, r;
+    size_t i, found = 0;
+
+    if (!ps || !s || !hits) return 0;
+    nd = ps->nodes;
+    memset(hits, 0, (ps->count + 7) / 8);
+
+    /* Pass 1: candidate rules whose anchor occurs after the cursor */
+    for (p = s->view.end; p < s->str.end; p++) {
+        unsigned char c = (unsigned char)*p;
+        while ((t = sno_ac_edge(ps, state, c)) == 0 && state != 0) state = nd[state].fail;
+        state = t;
+        for (k = nd[state].out ? state : nd[state].dict; k; k = nd[k].dict) {
+            for (r = nd[k].out; r; r = ps->next[r - 1]) sno_bit_set(hits, r - 1u);
+        }
+    }
+    for (r = ps->always; r; r = ps->next[r - 1]) sno_bit_set(hits, r - 1u);
+
+    /* Pass 2: confirm candidates with the full pattern */
+    for (i = 0; i < ps->count; i++) {
+        if (!sno_bit_get(hits, i)) continue;
+        if (sno_patset_try(&ps->rules[i], s)) found++;
+        else hits[i >> 3] &= (unsigned char)~(1u << (i & 7));
+    }
+    return found;
+}
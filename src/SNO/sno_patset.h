@@ -0,0 +1,60 @@
+/* sno_patset.h — Multi-pattern prefilter over compiled patterns */
+
+#ifndef SNO_PATSET_H
+#define SNO_PATSET_H
+
+#include "sno_pat.h"
+
+/**
+ * @file sno_patset.h
+ * @brief Test many compiled rules against one subject in a single scan
+ *
+ * Each rule's anchor (sno_pat_anchor: a literal every match must consume) is
+ * inserted into an Aho-Corasick automaton. One pass over the subject marks the
+ * rules whose anchor occurs; only those, plus rules without any anchor, run
+ * through sno_match. Cost is O(line + hits) instead of O(rules × line).
+ *
+ * Automaton nodes live in caller memory: one node per distinct anchor prefix
+ * (at most the total anchor length + 1). Children are sparse sibling lists;
+ * root transitions are a dense table, so most bytes cost one lookup.
+ */
+
+#ifndef SNO_PATSET_MAX
+#define SNO_PATSET_MAX 1024   /* Max rules per set */
+#endif
+
+typedef struct {
+    unsigned short child;     /**< First child (0 = none) */
+    unsigned short sibling;   /**< Next child of same parent */
+    unsigned short fail;      /**< Longest proper suffix state */
+    unsigned short dict;      /**< Nearest suffix state with output (0 = none) */
+    unsigned short out;       /**< First rule ending here, index + 1 (0 = none) */
+    unsigned char c;          /**< Edge label into this node */
+    unsigned char depth;      /**< Anchor prefix length */
+} sno_patset_node_t;
+
+typedef struct {
+    const sno_pat_t* rules;             /**< Rule array (caller-owned, not copied) */
+    size_t count;                       /**< Number of rules */
+    sno_patset_node_t* nodes;           /**< Automaton (caller-owned) */
+    size_t node_count;                  /**< Nodes in use; node 0 is root */
+    unsigned short root[256];           /**< Dense root transitions (0 = none) */
+    unsigned short next[SNO_PATSET_MAX];/**< Per rule: next rule in same output list, index + 1 */
+    unsigned short always;              /**< Rules without anchor, index + 1 list */
+} sno_patset_t;
+
+/**
+ * Build set over rules[0..count) using nodes[0..max_nodes).
+ * False when count exceeds SNO_PATSET_MAX, a rule is unterminated, or nodes run out.
+ */
+bool sno_patset(sno_patset_t* ps, const sno_pat_t* rules, size_t count,
+                sno_patset_node_t* nodes, size_t max_nodes);
+
+/**
+ * Match every rule at the cursor of s; s itself is not modified.
+ * Sets bit i of hits (hits[i >> 3] bit i & 7, (count + 7) / 8 bytes) for each
+ * matching rule i. Returns the number of matching rules.
+ */
+size_t sno_patset_match(const sno_patset_t* ps, const sno_subject_t* s, unsigned char* hits);
+
+#endif
@@ -0,0 +1,86 @@
+#include "sno_patset_test.h"
+#include "sno_constants.h"
+#include <assert.h>
+#include <string.h>
+
+#define RULES 40
+
+void sno_patset_test(void) {
+    static sno_pat_t rules[RULES];
+    static unsigned char code[RULES][96];
+    static sno_patset_node_t nodes[512];
+    static sno_patset_t ps;
+    static const char* words[] = {"error", "err", "rror", "warn", "timeout", "out", "he", "she", "hers", "his"};
+    static const char* lines[] = {
+        "kernel: error on disk", "warn: timeout talking to host", "ushers his hers", "nothing here",
+        "", "err", "rrorerror", "shout", "x=12 timeout", "WARN upper",
+    };
+    sno_subject_t s = {0};
+    sno_view_t lit;
+    unsigned char hits[(RULES + 7) / 8];
+    size_t i, k, n, expect;
+
+    /* Rules: BREAK to word | word after digits | alternation-only (no anchor) */
+    for (i = 0; i < RULES; i++) {
+        const char* w = words[i % 10];
+        sno_pat(&rules[i], code[i], sizeof(code[i]));
+        switch (i / 10) {
+        case 0:
+            sno_pat_break(&rules[i], w[0] == 'e' ? "e" : w[0] == 'w' ? "w" : w[0] == 't' ? "t" : w[0] == 'o' ? "o" : w[0] == 'r' ? "r" : "hs");
+            sno_pat_lit(&rules[i], w);
+            break;
+        case 1:
+            sno_pat_lit(&rules[i], w);                           /* anchored at cursor */
+            break;
+        case 2:
+            sno_pat_break(&rules[i], "=");
+            sno_pat_ch(&rules[i], '=');
+            sno_pat_span(&rules[i], SNO_DIGITS);
+            sno_pat_ch(&rules[i], ' ');
+            sno_pat_lit(&rules[i], w);
+            break;
+        default:
+            sno_pat_alt(&rules[i]);
+            sno_pat_lit(&rules[i], w);
+            sno_pat_or(&rules[i]);
+            sno_pat_span(&rules[i], SNO_LETTERS);
+            sno_pat_end(&rules[i]);
+            break;
+        }
+        assert(sno_pat_done(&rules[i]));
+    }
+    assert(sno_pat_anchor(&rules[0], &lit) && lit.end - lit.begin == 5 && !memcmp(lit.begin, "error", 5));
+    assert(sno_pat_anchor(&rules[20], &lit) && lit.end - lit.begin == 5);      /* longest of '=' ' ' lit */
+    assert(!sno_pat_anchor(&rules[30], &lit));                                  /* only inside alternation */
+
+    assert(sno_patset(&ps, rules, RULES, nodes, sizeof(nodes) / sizeof(nodes[0])));
+
+    /* Same answers as running every rule */
+    for (k = 0; k < sizeof(lines) / sizeof(lines[0]); k++) {
+        sno_bind(&s, lines[k]);
+        n = sno_patset_match(&ps, &s, hits);
+        expect = 0;
+        for (i = 0; i < RULES; i++) {
+            sno_subject_t t = s;
+            bool m = sno_match(&t, &rules[i]);
+            assert(m == (bool)((hits[i >> 3] >> (i & 7)) & 1));
+            expect += m;
+        }
+        assert(n == expect);
+        assert(s.view.end == s.str.begin);                                      /* subject untouched */
+    }
+
+    /* Suffix outputs: "ushers" holds she, he, hers */
+    sno_bind(&s, "ushers");
+    sno_len(&s, 1);
+    sno_patset_match(&ps, &s, hits);
+    assert((hits[17 >> 3] >> (17 & 7)) & 1);                                    /* lit "she" at cursor */
+    assert((hits[7 >> 3] >> (7 & 7)) & 1);                                      /* break, then "she" */
+    assert(!((hits[16 >> 3] >> (16 & 7)) & 1));                                 /* "he" not at cursor */
+
+    /* Too few nodes, bad args */
+    assert(!sno_patset(&ps, rules, RULES, nodes, 8));
+    assert(!sno_patset(&ps, rules, SNO_PATSET_MAX + 1, nodes, 512));
+    assert(sno_patset_match(NULL, &s, hits) == 0 && sno_patset_match(&ps, &s, NULL) == 0);
+    assert(sno_patset(&ps, rules, 0, nodes, 1) && sno_patset_match(&ps, &s, hits) == 0);
+}
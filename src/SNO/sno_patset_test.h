@@ -0,0 +1,9 @@
+#ifndef SNO_PATSET_TEST_H
+#define SNO_PATSET_TEST_H
+
+#include "sno_patset.h"
+#include <stdio.h>
+
+void sno_patset_test();
+
+#endif
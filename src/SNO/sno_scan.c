@@ -0,0 +1,299 @@
+/* sno_scan.c — BREAK/SPAN scan kernels: SIMD on hosts, scalar on 8086 */
+#include "sno_scan.h"
+#include <string.h>
+
+#if !defined(SNO_NO_SIMD) && defined(__GNUC__) && \
+    (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+#define SNO_SCAN_X86 1
+#include <immintrin.h>
+#elif !defined(SNO_NO_SIMD) && defined(__GNUC__) && defined(__aarch64__) && defined(__ARM_NEON)
+#define SNO_SCAN_NEON 1
+#include <arm_neon.h>
+#include <stdint.h>
+#endif
+
+#if defined(SNO_SCAN_X86) || defined(SNO_SCAN_NEON)
+#define SNO_SCAN_VECTOR 1
+#endif
+
+/* Sets up to this size use per-character compare kernels; larger sets go through a bitmap */
+#define SNO_SCAN_SMALL 4
+
+/* A large set string is converted to a bitmap only when this many bytes remain */
+#define SNO_SCAN_MIN 32
+
+/* Literal search uses Horspool from this length and haystack size; memchr + memcmp below */
+#define SNO_SCAN_HORSPOOL_LIT 4
+#define SNO_SCAN_HORSPOOL_MIN 256
+
+/* === Scalar Reference (8086 target, tails, and fallback) === */
+
+static cstr_t* scan_set_scalar(cstr_t* pos, cstr_t* end, const char* set, bool span)
+{
+    while (pos < end && (*pos != '\0' && strchr(set, *pos) != NULL) == span) pos++;
+    return pos;
+}
+
+static cstr_t* scan_cset_scalar(cstr_t* pos, cstr_t* end, const sno_cset_t* cs, bool span)
+{
+    while (pos < end && (sno_cset_has(cs, *pos) != 0) == span) pos++;
+    return pos;
+}
+
+/*
+ * Vector kernels process whole blocks only and return the first stopping
+ * position inside a block, or where the last whole block ended. The scalar
+ * loop then finishes the tail (or confirms the hit immediately).
+ *
+ * Small sets: compare against each of 4 set characters, OR, movemask.
+ * Bitmap sets: row = bits[c >> 3] via two 16-entry shuffles (c < 128 and
+ * c >= 128), bit = 1 << (c & 7) via a third shuffle, member = (row & bit) != 0.
+ */
+
+#if defined(SNO_SCAN_X86)
+
+typedef cstr_t* (*scan_set4_fn)(cstr_t* pos, cstr_t* end, const char* c4, bool span);
+typedef cstr_t* (*scan_cset_fn)(cstr_t* pos, cstr_t* end, const sno_cset_t* cs, bool span);
+
+static cstr_t* scan_set4_sse2(cstr_t* pos, cstr_t* end, const char* c4, bool span)
+{
+    const __m128i c0 = _mm_set1_epi8(c4[0]), c1 = _mm_set1_epi8(c4[1]);
+    const __m128i c2 = _mm_set1_epi8(c4[2]), c3 = _mm_set1_epi8(c4[3]);
+    const unsigned flip = span ? 0xFFFFu : 0u;
+    while (end - pos >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)pos);
+        __m128i m = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, c0), _mm_cmpeq_epi8(v, c1)),
+                                 _mm_or_si128(_mm_cmpeq_epi8(v, c2), _mm_cmpeq_epi8(v, c3)));
+        unsigned bits = (unsigned)_mm_movemask_epi8(m) ^ flip;
+        if (bits) return pos + __builtin_ctz(bits);
+        pos += 16;
+    }
+    return pos;
+}
+
+__attribute__((target("avx2")))
+static cstr_t* scan_set4_avx2(cstr_t* pos, cstr_t* end, const char* c4, bool span)
+{
+    const __m256i c0 = _mm256_set1_epi8(c4[0]), c1 = _mm256_set1_epi8(c4[1]);
+    const __m256i c2 = _mm256_set1_epi8(c4[2]), c3 = _mm256_set1_epi8(c4[3]);
+    const unsigned flip = span ? 0xFFFFFFFFu : 0u;
+    while (end - pos >= 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)pos);
+        __m256i m = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, c0), _mm256_cmpeq_epi8(v, c1)),
+                                    _mm256_or_si256(_mm256_cmpeq_epi8(v, c2), _mm256_cmpeq_epi8(v, c3)));
+        unsigned bits = (unsigned)_mm256_movemask_epi8(m) ^ flip;
+        if (bits) return pos + __builtin_ctz(bits);
+        pos += 32;
+    }
+    return pos;
+}
+
+static cstr_t* scan_cset_none(cstr_t* pos, cstr_t* end, const sno_cset_t* cs, bool span)
+{
+    (void)end; (void)cs; (void)span;
+    return pos;                                  /* no shuffle unit: scalar does it all */
+}
+
+__attribute__((target("ssse3")))
+static cstr_t* scan_cset_ssse3(cstr_t* pos, cstr_t* end, const sno_cset_t* cs, bool span)
+{
+    const __m128i lo = _mm_loadu_si128((const __m128i*)cs->bits);
+    const __m128i hi = _mm_loadu_si128((const __m128i*)(cs->bits + 16));
+    const __m128i pow2 = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+    const __m128i m0f = _mm_set1_epi8(0x0F), m07 = _mm_set1_epi8(0x07), zero = _mm_setzero_si128();
+    const unsigned flip = span ? 0xFFFFu : 0u;
+    while (end - pos >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)pos);
+        __m128i idx = _mm_and_si128(_mm_srli_epi16(v, 3), m0f);
+        __m128i high = _mm_cmplt_epi8(v, zero);
+        __m128i row = _mm_or_si128(_mm_andnot_si128(high, _mm_shuffle_epi8(lo, idx)),
+                                   _mm_and_si128(high, _mm_shuffle_epi8(hi, idx)));
+        __m128i bit = _mm_shuffle_epi8(pow2, _mm_and_si128(v, m07));
+        __m128i m = _mm_cmpeq_epi8(_mm_and_si128(row, bit), bit);
+        unsigned bits = (unsigned)_mm_movemask_epi8(m) ^ flip;
+        if (bits) return pos + __builtin_ctz(bits);
+        pos += 16;
+    }
+    return pos;
+}
+
+__attribute__((target("avx2")))
+static cstr_t* scan_cset_avx2(cstr_t* pos, cstr_t* end, const sno_cset_t* cs, bool span)
+{
+    const __m256i lo = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)cs->bits));
+    const __m256i hi = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)(cs->bits + 16)));
+    const __m256i pow2 = _mm256_broadcastsi128_si256(
+        _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128));
+    const __m256i m0f = _mm256_set1_epi8(0x0F), m07 = _mm256_set1_epi8(0x07), zero = _mm256_setzero_si256();
+    const unsigned flip = span ? 0xFFFFFFFFu : 0u;
+    while (end - pos >= 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)pos);
+        __m256i idx = _mm256_and_si256(_mm256_srli_epi16(v, 3), m0f);
+        __m256i high = _mm256_cmpgt_epi8(zero, v);
+        __m256i row = _mm256_or_si256(_mm256_andnot_si256(high, _mm256_shuffle_epi8(lo, idx)),
+                                      _mm256_and_si256(high, _mm256_shuffle_epi8(hi, idx)));
+        __m256i bit = _mm256_shuffle_epi8(pow2, _mm256_and_si256(v, m07));
+        __m256i m = _mm256_cmpeq_epi8(_mm256_and_si256(row, bit), bit);
+        unsigned bits = (unsigned)_mm256_movemask_epi8(m) ^ flip;
+        if (bits) return pos + __builtin_ctz(bits);
+        pos += 32;
+    }
+    return pos;
+}
+
+/* SSE2 is baseline; upgrade once at load time */
+static scan_set4_fn scan_set4 = scan_set4_sse2;
+static scan_cset_fn scan_cset = scan_cset_none;
+
+__attribute__((constructor))
+static void scan_select(void)
+{
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        scan_set4 = scan_set4_avx2;
+        scan_cset = scan_cset_avx2;
+    } else if (__builtin_cpu_supports("ssse3")) {
+        scan_cset = scan_cset_ssse3;
+    }
+}
+
+#define scan_has_cset() (scan_cset != scan_cset_none)
+
+#elif defined(SNO_SCAN_NEON)
+
+static cstr_t* scan_set4(cstr_t* pos, cstr_t* end, const char* c4, bool span)
+{
+    const uint8x16_t c0 = vdupq_n_u8((unsigned char)c4[0]), c1 = vdupq_n_u8((unsigned char)c4[1]);
+    const uint8x16_t c2 = vdupq_n_u8((unsigned char)c4[2]), c3 = vdupq_n_u8((unsigned char)c4[3]);
+    const uint64_t flip = span ? ~(uint64_t)0 : 0;
+    while (end - pos >= 16) {
+        uint8x16_t v = vld1q_u8((const uint8_t*)pos);
+        uint8x16_t m = vorrq_u8(vorrq_u8(vceqq_u8(v, c0), vceqq_u8(v, c1)),
+                                vorrq_u8(vceqq_u8(v, c2), vceqq_u8(v, c3)));
+        /* Narrow to one nibble per byte: 64-bit mask, byte i ↔ bits 4i..4i+3 */
+        uint64_t bits = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(m), 4)), 0) ^ flip;
+        if (bits) return pos + (__builtin_ctzll(bits) >> 2);
+        pos += 16;
+    }
+    return pos;
+}
+
+static cstr_t* scan_cset(cstr_t* pos, cstr_t* end, const sno_cset_t* cs, bool span)
+{
+    uint8x16x2_t tbl;
+    const uint8x16_t one = vdupq_n_u8(1), m07 = vdupq_n_u8(7);
+    const uint64_t flip = span ? ~(uint64_t)0 : 0;
+    tbl.val[0] = vld1q_u8(cs->bits);
+    tbl.val[1] = vld1q_u8(cs->bits + 16);
+    while (end - pos >= 16) {
+        uint8x16_t v = vld1q_u8((const uint8_t*)pos);
+        uint8x16_t row = vqtbl2q_u8(tbl, vshrq_n_u8(v, 3));
+        uint8x16_t bit = vshlq_u8(one, vreinterpretq_s8_u8(vandq_u8(v, m07)));
+        uint8x16_t m = vtstq_u8(row, bit);
+        uint64_t bits = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(m), 4)), 0) ^ flip;
+        if (bits) return pos + (__builtin_ctzll(bits) >> 2);
+        pos += 16;
+    }
+    return pos;
+}
+
+#define scan_has_cset() 1
+
+#endif
+
+/* === Public Kernels === */
+
+cstr_t* sno_scan_set(cstr_t* pos, cstr_t* end, const char* set, bool span)
+{
+    if (!span && set[0] && !set[1]) {            /* single-character BREAK → memchr / SCASB */
+        return sno_scan_chr(pos, end, set[0]);
+    }
+#if defined(SNO_SCAN_VECTOR)
+    size_t n = strlen(set);
+    if (n && n <= SNO_SCAN_SMALL) {
+        char c4[SNO_SCAN_SMALL];
+        size_t i;
+        for (i = 0; i < SNO_SCAN_SMALL; i++) c4[i] = set[i % n];  /* pad by repeating members */
+        pos = scan_set4(pos, end, c4, span);
+    } else if (n && scan_has_cset() && end - pos >= SNO_SCAN_MIN) {
+        sno_cset_t cs;
+        sno_cset(&cs, set);
+        return scan_cset_scalar(scan_cset(pos, end, &cs, span), end, &cs, span);
+    }
+#endif
+    return scan_set_scalar(pos, end, set, span);
+}
+
+cstr_t* sno_scan_cset(cstr_t* pos, cstr_t* end, const sno_cset_t* cs, bool span)
+{
+#if defined(SNO_SCAN_VECTOR)
+    pos = scan_cset(pos, end, cs, span);
+#endif
+    return scan_cset_scalar(pos, end, cs, span);
+}
+
+cstr_t* sno_scan_lit(cstr_t* pos, cstr_t* end, const char* lit, size_t m)
+{
+    if (m == 0) return pos;
+    if (m > (size_t)(end - pos)) return NULL;
+    if (m < SNO_SCAN_HORSPOOL_LIT || (size_t)(end - pos) < SNO_SCAN_HORSPOOL_MIN) {
+        cstr_t* last = end - m;                  /* memchr to each candidate first char */
+        while (pos <= last && (pos = sno_scan_chr(pos, last + 1, lit[0])) <= last) {
+            if (sno_scan_eq(pos + 1, lit + 1, m - 1)) return pos;
+            pos++;
+        }
+        return NULL;
+    } else {
+        /* Horspool: shift by distance of window's last byte from end of lit (capped at 255) */
+        unsigned char skip[256];
+        unsigned char lastc = (unsigned char)lit[m - 1];
+        cstr_t* last = end - m;
+        size_t i;
+        memset(skip, m > 255 ? 255 : (int)m, sizeof(skip));
+        for (i = 0; i + 1 < m; i++) {
+            size_t d = m - 1 - i;
+            skip[(unsigned char)lit[i]] = (unsigned char)(d > 255 ? 255 : d);
+        }
+        while (pos <= last) {
+            unsigned char c = (unsigned char)pos[m - 1];
+            if (c == lastc && sno_scan_eq(pos, lit, m - 1)) return pos;
+            pos += skip[c];
+        }
+        return NULL;
+    }
+}
+
+/* === Reverse Kernels === */
+
+cstr_t* sno_scan_rset(cstr_t* begin, cstr_t* end, const char* set, bool span)
+{
+    if (set[0] && !set[1]) {                     /* single character: no strchr */
+        char c = set[0];
+        while (end > begin && (end[-1] == c) == span) end--;
+        return end;
+    }
+    if (end - begin >= SNO_SCAN_MIN) {           /* long range: bitmap membership */
+        sno_cset_t cs;
+        sno_cset(&cs, set);
+        return sno_scan_rcset(begin, end, &cs, span);
+    }
+    while (end > begin && (end[-1] != '\0' && strchr(set, end[-1]) != NULL) == span) end--;
+    return end;
+}
+
+cstr_t* sno_scan_rcset(cstr_t* begin, cstr_t* end, const sno_cset_t* cs, bool span)
+{
+    while (end > begin && (sno_cset_has(cs, end[-1]) != 0) == span) end--;
+    return end;
+}
+
+cstr_t* sno_scan_rlit(cstr_t* begin, cstr_t* end, const char* lit, size_t m)
+{
+    cstr_t* pos;
+    if (m == 0) return end;
+    if (m > (size_t)(end - begin)) return NULL;
+    for (pos = end - m; ; pos--) {               /* last byte first: cheapest reject */
+        if (pos[m - 1] == lit[m - 1] && sno_scan_eq(pos, lit, m - 1)) return pos;
+        if (pos == begin) return NULL;
+    }
+}
@@ -0,0 +1,174 @@
+/* sno_scan.h — Internal BREAK/SPAN scan kernels */
+
+#ifndef SNO_SCAN_H
+#define SNO_SCAN_H
+
+#include "sno.h"
+#include <string.h>
+
+/**
+ * @file sno_scan.h
+ * @brief Bounded scan kernels behind sno_span/sno_break and their _cset variants
+ *
+ * Each kernel scans [pos, end) and returns the first position that stops the
+ * scan (or end): span=true stops at the first NON-member, span=false (BREAK)
+ * stops at the first member. Host builds check 16/32 bytes per step with
+ * SSE2/SSSE3/AVX2 (one-time CPU dispatch) or NEON (AArch64); the 8086 target
+ * and SNO_NO_SIMD builds use the scalar loops. Results are identical either way.
+ * A single-character BREAK reduces to memchr (REPNE SCASB on DOS).
+ */
+
+/** Scan against set string; '\0' is never a member */
+cstr_t* sno_scan_set(cstr_t* pos, cstr_t* end, const char* set, bool span);
+
+/** Scan against precompiled bitmap set */
+cstr_t* sno_scan_cset(cstr_t* pos, cstr_t* end, const sno_cset_t* cs, bool span);
+
+/** First occurrence of lit[0..m) in [pos, end), or NULL (memchr / Horspool) */
+cstr_t* sno_scan_lit(cstr_t* pos, cstr_t* end, const char* lit, size_t m);
+
+/*
+ * Reverse kernels: scan [begin, end) from end toward begin and return p such
+ * that [p, end) is the longest suffix scanned (span: all members; break: no
+ * members). Scalar on every target: suffix runs are short by nature.
+ */
+
+/** Reverse scan against set string; '\0' is never a member */
+cstr_t* sno_scan_rset(cstr_t* begin, cstr_t* end, const char* set, bool span);
+
+/** Reverse scan against precompiled bitmap set */
+cstr_t* sno_scan_rcset(cstr_t* begin, cstr_t* end, const sno_cset_t* cs, bool span);
+
+/** Last occurrence of lit[0..m) in [begin, end), or NULL */
+cstr_t* sno_scan_rlit(cstr_t* begin, cstr_t* end, const char* lit, size_t m);
+
+/*
+ * Byte primitives behind single-character BREAK, sno_lit and sno_bind.
+ * The DOS target runs them as inline 8086 string instructions (REPNE SCASB,
+ * REPE CMPSB): one instruction per byte instead of a compiled loop, whatever
+ * the optimization level. Hosts use the C library, which is already vectorized.
+ * Define SNO_NO_ASM to use the C library on DOS as well.
+ *
+ * SNO_SCAN_MODEL compiles the DOS path on a host, with each instruction
+ * replaced by a C model of its register semantics, so the host test suite
+ * checks the wrappers below (CX arithmetic, ZF test) without a DOS toolchain.
+ */
+
+#if (defined(__WATCOMC__) && defined(__DOS__) && !defined(SNO_NO_ASM)) || defined(SNO_SCAN_MODEL)
+#define SNO_SCAN_STRING_OPS 1
+
+#if defined(SNO_SCAN_MODEL)
+
+/* REPNE SCASB: CX = n, stop after the byte equal to AL; CX left over */
+static inline unsigned sno_scan_scasb(cstr_t* p, unsigned n, char c)
+{
+    while (n) {
+        n--;
+        if (*p++ == c) break;
+    }
+    return n;
+}
+
+/* CX = 0xFFFF, REPNE SCASB for '\0', NOT CX, DEC CX (16-bit registers) */
+static inline unsigned sno_scan_scasz(cstr_t* p)
+{
+    unsigned cx = 0xFFFFu;
+    while (cx) {
+        cx--;
+        if (*p++ == '\0') break;
+    }
+    return ((~cx) & 0xFFFFu) - 1;
+}
+
+/* REPE CMPSB: CX = n > 0, stop after the first unequal pair; LAHF, ZF = 0x40 */
+static inline unsigned char sno_scan_cmpsb(cstr_t* a, cstr_t* b, unsigned n)
+{
+    bool zf = true;
+    while (n) {
+        n--;
+        zf = *a++ == *b++;
+        if (!zf) break;
+    }
+    return zf ? 0x40 : 0x00;
+}
+
+#else
+
+/* REPNE SCASB for c over p[0..n), n > 0: CX left over (0 = not found, or found at p[n-1]) */
+unsigned sno_scan_scasb(cstr_t* p, unsigned n, char c);
+#pragma aux sno_scan_scasb = \
+    "repne scasb"            \
+    parm [es di] [cx] [al]   \
+    value [cx]               \
+    modify exact [di cx];
+
+/* REPNE SCASB for '\0' from CX = 0xFFFF: length of the string at p */
+unsigned sno_scan_scasz(cstr_t* p);
+#pragma aux sno_scan_scasz = \
+    "mov cx, -1"             \
+    "xor al, al"             \
+    "repne scasb"            \
+    "not cx"                 \
+    "dec cx"                 \
+    parm [es di]             \
+    value [cx]               \
+    modify exact [al di cx];
+
+/* REPE CMPSB over n > 0 bytes: returns FLAGS low byte after the compare (0x40 = ZF = equal) */
+unsigned char sno_scan_cmpsb(cstr_t* a, cstr_t* b, unsigned n);
+#pragma aux sno_scan_cmpsb = \
+    "push ds"                \
+    "mov ds, dx"             \
+    "repe cmpsb"             \
+    "lahf"                   \
+    "mov al, ah"             \
+    "pop ds"                 \
+    parm [dx si] [es di] [cx] \
+    value [al]               \
+    modify exact [ax si di cx];
+
+#endif
+
+/** First c in [pos, end), or end */
+static inline cstr_t* sno_scan_chr(cstr_t* pos, cstr_t* end, char c)
+{
+    unsigned n = (unsigned)(end - pos), rem;
+    if (n == 0) return end;
+    rem = sno_scan_scasb(pos, n, c);
+    if (rem) return pos + (n - rem - 1);
+    return pos[n - 1] == c ? end - 1 : end;
+}
+
+/** a[0..n) == b[0..n) */
+static inline bool sno_scan_eq(cstr_t* a, cstr_t* b, size_t n)
+{
+    return n == 0 || (sno_scan_cmpsb(a, b, (unsigned)n) & 0x40) != 0;
+}
+
+/** strlen */
+static inline size_t sno_scan_strlen(cstr_t* p)
+{
+    return sno_scan_scasz(p);
+}
+
+#else
+
+static inline cstr_t* sno_scan_chr(cstr_t* pos, cstr_t* end, char c)
+{
+    cstr_t* hit = (cstr_t*)memchr(pos, c, (size_t)(end - pos));
+    return hit ? hit : end;
+}
+
+static inline bool sno_scan_eq(cstr_t* a, cstr_t* b, size_t n)
+{
+    return memcmp(a, b, n) == 0;
+}
+
+static inline size_t sno_scan_strlen(cstr_t* p)
+{
+    return strlen(p);
+}
+
+#endif
+
+#endif
@@ -0,0 +1,136 @@
+#include "sno_split.h"
+#include <string.h>
+
+#if !defined(SNO_NO_SIMD) && defined(__GNUC__) && \
+    (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+#define SNO_SPLIT_X86 1
+#include <emmintrin.h>
+#endif
+
+/* === Internal Helpers === */
+
+typedef struct {
+    sno_view_t* fields;
+    size_t max;
+    size_t n;          /* fields seen so far */
+    cstr_t* start;     /* start of current field */
+    char quote;
+} split_out_t;
+
+/* Close the current field at end; strip enclosing quotes */
+static void split_emit(split_out_t* o, cstr_t* end)
+{
+    cstr_t* b = o->start;
+    cstr_t* e = end;
+    if (o->quote && e - b >= 2 && b[0] == o->quote && e[-1] == o->quote) {
+        b++;
+        e--;
+    }
+    if (o->n < o->max) {
+        o->fields[o->n].begin = b;
+        o->fields[o->n].end = e;
+    }
+    o->n++;
+    o->start = end + 1;                          /* past the delimiter */
+}
+
+/* Byte loop from p with quoting state inq; returns final state */
+static bool split_scalar(split_out_t* o, cstr_t* p, cstr_t* end, const sno_cset_t* delims, bool inq)
+{
+    char q = o->quote;
+    for (; p < end; p++) {
+        if (q && *p == q) inq = !inq;
+        else if (!inq && sno_cset_has(delims, *p)) split_emit(o, p);
+    }
+    return inq;
+}
+
+#if defined(SNO_SPLIT_X86)
+
+/* Bit i of result = XOR of bits 0..i of m (inside-quotes mask for one block) */
+static unsigned split_prefix_xor(unsigned m)
+{
+    m ^= m << 1;
+    m ^= m << 2;
+    m ^= m << 4;
+    m ^= m << 8;
+    return m & 0xFFFF;
+}
+
+/* Whole 16-byte blocks from *pp; advances *pp, returns quoting state */
+static bool split_sse2(split_out_t* o, cstr_t** pp, cstr_t* end, const char* d, size_t nd, bool inq)
+{
+    cstr_t* p = *pp;
+    const __m128i qv = _mm_set1_epi8(o->quote);
+    __m128i dv[SNO_SPLIT_SIMD_DELIMS];
+    size_t k;
+    for (k = 0; k < nd; k++) dv[k] = _mm_set1_epi8(d[k]);
+    for (; end - p >= 16; p += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(const void*)p);
+        __m128i hit = _mm_cmpeq_epi8(v, dv[0]);
+        unsigned qm = o->quote ? (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(v, qv)) : 0;
+        unsigned dm, inside;
+        for (k = 1; k < nd; k++) hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, dv[k]));
+        dm = (unsigned)_mm_movemask_epi8(hit) & ~qm;
+        inside = split_prefix_xor(qm) ^ (inq ? 0xFFFFu : 0u);
+        inq = (inside >> 15) & 1;
+        dm &= ~inside;
+        while (dm) {                             /* one bit per field boundary */
+            split_emit(o, p + __builtin_ctz(dm));
+            dm &= dm - 1;
+        }
+    }
+    *pp = p;
+    return inq;
+}
+
+#endif
+
+/* === Splitting === */
+
+size_t sno_split(sno_subject_t* s, const sno_cset_t* delims, char quote, sno_view_t* fields, size_t max)
+{
+    split_out_t o;
+    cstr_t* p;
+    bool inq = false;
+    if (!s || !delims || (!fields && max)) return 0;
+    o.fields = fields;
+    o.max = max;
+    o.n = 0;
+    o.quote = quote;
+    o.start = p = s->view.end;
+#if defined(SNO_SPLIT_X86)
+    {
+        char d[SNO_SPLIT_SIMD_DELIMS];
+        size_t nd = 0;
+        unsigned i, c;
+        for (i = 0; i < sizeof delims->bits && nd <= SNO_SPLIT_SIMD_DELIMS; i++) {
+            if (!delims->bits[i]) continue;      /* 8 non-members at once */
+            for (c = i * 8; c < i * 8 + 8; c++) {
+                if (sno_cset_has(delims, c) && nd++ < SNO_SPLIT_SIMD_DELIMS) d[nd - 1] = (char)c;
+            }
+        }
+        if (nd >= 1 && nd <= SNO_SPLIT_SIMD_DELIMS) inq = split_sse2(&o, &p, s->str.end, d, nd, inq);
+    }
+#endif
+    inq = split_scalar(&o, p, s->str.end, delims, inq);
+    if (inq) return 0;                           /* unterminated quote: cursor unchanged */
+    split_emit(&o, s->str.end);                  /* last field */
+    s->view.begin = s->view.end;
+    s->view.end = s->str.end;
+    return o.n;
+}
+
+bool sno_split_unquote(char* dst, size_t cap, sno_view_t f, char quote)
+{
+    cstr_t* p;
+    size_t n = 0;
+    if (!dst || !cap || !f.begin) return false;
+    for (p = f.begin; p < f.end; p++) {
+        if (n + 1 >= cap) return false;          /* no room for this byte and '\0' */
+        dst[n++] = *p;
+        if (quote && *p == quote && p + 1 < f.end && p[1] == quote) p++;   /* "" → " */
+    }
+    dst[n] = '\0';
+    return true;
+}
@@ -0,0 +1,9 @@
+#ifndef SNO_SPLIT_TEST_H
+#define SNO_SPLIT_TEST_H
+
+#include "sno_split.h"
+#include <stdio.h>
+
+void sno_split_test();
+
+#endif
@@ -0,0 +1,128 @@
+#include "sno_stats.h"
+#include "sno_trace.h"
+
+/* How a primitive reads the subject, for bytes examined */
+typedef enum {
+    STAT_NONE,   /* positioning only: reads no bytes */
+    STAT_STEP,   /* reads what it consumes; a failure reads one byte (literals measure instead) */
+    STAT_SPAN,   /* reads the run plus the byte that stops it; a failure reads one byte */
+    STAT_SCAN,   /* as SPAN, but a failure reads to the end of the subject */
+    STAT_DELIM,  /* reads exactly what it consumes; a failure reads to the end */
+    STAT_RSPAN,  /* backward from the end: the piece plus the byte before it; a failure reads one */
+    STAT_RSCAN   /* as RSPAN, but a failure reads back to the cursor */
+} stat_kind_t;
+
+static const struct {
+    const char* name;
+    stat_kind_t kind;
+} stat_info[SNO_STAT_COUNT] = {
+    {"sno_ch", STAT_STEP},           {"sno_lit", STAT_STEP},
+    {"sno_find_lit", STAT_SCAN},     {"sno_ch_ci", STAT_STEP},
+    {"sno_lit_ci", STAT_STEP},       {"sno_oneof", STAT_STEP},
+    {"sno_len", STAT_NONE},
+    {"sno_any", STAT_STEP},          {"sno_notany", STAT_STEP},
+    {"sno_span", STAT_SPAN},         {"sno_break", STAT_SCAN},
+    {"sno_any_cset", STAT_STEP},     {"sno_notany_cset", STAT_STEP},
+    {"sno_span_cset", STAT_SPAN},    {"sno_break_cset", STAT_SCAN},
+    {"sno_rspan", STAT_RSPAN},       {"sno_rbreak", STAT_RSCAN},
+    {"sno_rspan_cset", STAT_RSPAN},  {"sno_rbreak_cset", STAT_RSCAN},
+    {"sno_rfind_lit", STAT_RSCAN},
+    {"sno_tab", STAT_NONE},          {"sno_rtab", STAT_NONE},
+    {"sno_rem", STAT_NONE},
+    {"sno_bal", STAT_DELIM},          {"sno_bal_max", STAT_DELIM},
+    {"sno_bal_set", STAT_DELIM},      {"sno_bal_set_quoted", STAT_DELIM},
+};
+
+const char* sno_stats_name(sno_stat_id_t id)
+{
+    return (unsigned)id < SNO_STAT_COUNT ? stat_info[id].name : "?";
+}
+
+#ifdef SNO_HOOKS
+
+/* Range [*lo, *hi) a call from at read, per the primitive's access pattern */
+static void stat_range(sno_stat_id_t id, const sno_subject_t* s, cstr_t* at, bool ok,
+                       cstr_t** lo, cstr_t** hi)
+{
+    size_t left = (size_t)(s->str.end - at);      /* bytes available at entry */
+    size_t moved = ok && s->view.end > at ? (size_t)(s->view.end - at) : 0;
+    size_t n = 0;
+    switch (stat_info[id].kind) {
+    case STAT_STEP:
+        n = ok ? moved : (left ? 1 : 0);
+        break;
+    case STAT_SPAN:
+        n = ok ? moved + (moved < left ? 1 : 0) : (left ? 1 : 0);
+        break;
+    case STAT_SCAN:
+        n = ok ? moved + (moved < left ? 1 : 0) : left;
+        break;
+    case STAT_DELIM:
+        n = ok ? moved : left;
+        break;
+    case STAT_RSPAN:
+    case STAT_RSCAN:                              /* backward from str.end */
+        *hi = s->str.end;
+        if (ok) *lo = s->view.begin > at ? s->view.begin - 1 : at;
+        else *lo = stat_info[id].kind == STAT_RSCAN || !left ? at : s->str.end - 1;
+        return;
+    default:
+        break;
+    }
+    *lo = at;
+    *hi = at + n;
+}
+
+void sno_stats_record(sno_stat_id_t id, const sno_subject_t* s, cstr_t* at, bool ok, cstr_t* read)
+{
+    cstr_t* lo = at;
+    cstr_t* hi = at;
+    if ((unsigned)id >= SNO_STAT_COUNT) return;
+    if (s && at && read) hi = read;                  /* measured by the primitive */
+    else if (s && at) stat_range(id, s, at, ok, &lo, &hi);
+#ifdef SNO_STATS
+    {
+        sno_stat_t* st = &sno_stats.prim[id];
+        st->calls++;
+        if (ok) {
+            st->ok++;
+            if (s && at && s->view.end > at) st->advanced += (unsigned long)(s->view.end - at);
+        }
+        else st->fail++;
+        st->examined += (unsigned long)(hi - lo);
+    }
+#endif
+#ifdef SNO_TRACE
+    if (s && at) sno_trace_event(s, (unsigned)id, (size_t)(lo - s->str.begin), (size_t)(hi - s->str.begin), ok);
+#endif
+}
+
+#endif
+
+#ifdef SNO_STATS
+
+sno_stats_t sno_stats;
+
+void sno_stats_reset(void)
+{
+    size_t i;
+    for (i = 0; i < SNO_STAT_COUNT; i++) {
+        sno_stat_t* st = &sno_stats.prim[i];
+        st->calls = st->ok = st->fail = st->advanced = st->examined = 0;
+    }
+}
+
+void sno_stats_print(FILE* f)
+{
+    size_t i;
+    if (!f) return;
+    fprintf(f, "%-20s %10s %10s %10s %12s %12s\n", "primitive", "calls", "ok", "fail", "advanced", "examined");
+    for (i = 0; i < SNO_STAT_COUNT; i++) {
+        const sno_stat_t* st = &sno_stats.prim[i];
+        if (!st->calls) continue;
+        fprintf(f, "%-20s %10lu %10lu %10lu %12lu %12lu\n", stat_info[i].name,
+                st->calls, st->ok, st->fail, st->advanced, st->examined);
+    }
+}
+
+#endif
@@ -0,0 +1,91 @@
+/* sno_stats.h — Per-primitive call, outcome and byte counters (SNO_STATS builds) */
+
+#ifndef SNO_STATS_H
+#define SNO_STATS_H
+
+#include "sno.h"
+#include <stdio.h>
+
+/**
+ * @file sno_stats.h
+ * @brief Which primitive does the work, and how often each alternative fails
+ *
+ * Build the library with -DSNO_STATS and every matching and positioning
+ * primitive in sno.c counts, into the global sno_stats:
+ *   - calls, successes and failures
+ *   - bytes advanced (cursor movement on success)
+ *   - bytes examined (subject bytes read to reach the outcome)
+ *
+ * A high failure count on one of several || alternatives says reorder them;
+ * many bytes examined per byte advanced says switch a set string to a cset,
+ * or a chain of sno_lit to sno_oneof.
+ *
+ * Without SNO_STATS nothing is recorded and sno_stats_reset/sno_stats_print
+ * compile to nothing, so instrumented call sites can stay in release code.
+ * SNO_STATS also turns off the SNO_INLINE mappings so every call is counted.
+ * The same hook drives SNO_TRACE (sno_trace.h); the ids below name its events.
+ *
+ * Counters are plain globals: profile sno_parallel_records runs with
+ * nthreads = 1. Bytes examined is modelled per primitive: a scan counts its
+ * run plus the byte that stopped it (the whole remainder when it fails). A
+ * literal counts the bytes it compared, up to and including the first
+ * mismatch, so a long literal that fails late shows its full cost; sno_oneof
+ * counts its longest probe among the candidates it tried.
+ */
+
+typedef enum {
+    SNO_STAT_CH, SNO_STAT_LIT, SNO_STAT_FIND_LIT, SNO_STAT_CH_CI, SNO_STAT_LIT_CI, SNO_STAT_ONEOF,
+    SNO_STAT_LEN,
+    SNO_STAT_ANY, SNO_STAT_NOTANY, SNO_STAT_SPAN, SNO_STAT_BREAK,
+    SNO_STAT_ANY_CSET, SNO_STAT_NOTANY_CSET, SNO_STAT_SPAN_CSET, SNO_STAT_BREAK_CSET,
+    SNO_STAT_RSPAN, SNO_STAT_RBREAK, SNO_STAT_RSPAN_CSET, SNO_STAT_RBREAK_CSET, SNO_STAT_RFIND_LIT,
+    SNO_STAT_TAB, SNO_STAT_RTAB, SNO_STAT_REM,
+    SNO_STAT_BAL, SNO_STAT_BAL_MAX, SNO_STAT_BAL_SET, SNO_STAT_BAL_SET_QUOTED,
+    SNO_STAT_COUNT
+} sno_stat_id_t;
+
+typedef struct {
+    unsigned long calls;     /**< Times called */
+    unsigned long ok;        /**< Successes */
+    unsigned long fail;      /**< Failures (calls - ok) */
+    unsigned long advanced;  /**< Bytes the cursor moved on success */
+    unsigned long examined;  /**< Bytes read, success or failure */
+} sno_stat_t;
+
+typedef struct {
+    sno_stat_t prim[SNO_STAT_COUNT];
+} sno_stats_t;
+
+/** Primitive name for stat id ("sno_span", …); also names trace events */
+const char* sno_stats_name(sno_stat_id_t id);
+
+#if defined(SNO_STATS) || defined(SNO_TRACE)
+#define SNO_HOOKS 1         /* sno.c wraps each primitive with sno_stats_record */
+
+/**
+ * Record one call in the counters and/or the subject's trace: at = cursor
+ * before the call; read = end of the bytes read when the primitive measured
+ * it (literal compares), or NULL to use the primitive's model
+ */
+void sno_stats_record(sno_stat_id_t id, const sno_subject_t* s, cstr_t* at, bool ok, cstr_t* read);
+#endif
+
+#ifdef SNO_STATS
+
+/** Counters for the whole program */
+extern sno_stats_t sno_stats;
+
+/** Zero every counter */
+void sno_stats_reset(void);
+
+/** Table of the primitives called since the last reset */
+void sno_stats_print(FILE* f);
+
+#else
+
+#define sno_stats_reset() ((void)0)
+#define sno_stats_print(f) ((void)0)
+
+#endif
+
+#endif
@@ -0,0 +1,92 @@
+#include "sno_stats_test.h"
+#include "sno_constants.h"
+#include <assert.h>
+#include <string.h>
+
+void sno_stats_test()
+{
+    sno_subject_t s = {0};
+    sno_stats_reset();                       /* no-op without SNO_STATS */
+    sno_stats_print(NULL);
+
+#ifdef SNO_STATS
+    {
+        const sno_stat_t* st;
+        cstr_t* kw[] = {"get", "put"};
+        cstr_t* pw[] = {"put", "post"};
+        sno_lits_t t;
+        size_t k;
+
+        sno_bind(&s, "key = value;");
+
+        /* Successful span: advances 3, reads the stopping ' ' too */
+        assert(sno_span(&s, SNO_LETTERS));
+        st = &sno_stats.prim[SNO_STAT_SPAN];
+        assert(st->calls == 1 && st->ok == 1 && st->fail == 0);
+        assert(st->advanced == 3 && st->examined == 4);
+
+        /* Failed alternatives: two misses then a hit */
+        assert(!sno_ch(&s, '=') && !sno_ch(&s, ':') && sno_ch(&s, ' '));
+        st = &sno_stats.prim[SNO_STAT_CH];
+        assert(st->calls == 3 && st->ok == 1 && st->fail == 2);
+        assert(st->advanced == 1 && st->examined == 3);
+
+        /* Failed search reads the whole remainder; cursor unchanged */
+        assert(!sno_find_lit(&s, "#"));
+        st = &sno_stats.prim[SNO_STAT_FIND_LIT];
+        assert(st->fail == 1 && st->examined == strlen("= value;"));
+        assert(sno_break(&s, ";"));
+        st = &sno_stats.prim[SNO_STAT_BREAK];
+        assert(st->ok == 1 && st->advanced == strlen("= value") && st->examined == strlen("= value;"));
+
+        /* Positioning reads nothing */
+        assert(sno_rem(&s));
+        st = &sno_stats.prim[SNO_STAT_REM];
+        assert(st->calls == 1 && st->advanced == 1 && st->examined == 0);
+
+        /* Primitive calling primitive counts once (sno_bal → sno_bal_max) */
+        sno_bind(&s, "(a(b))c");
+        assert(sno_bal(&s, '(', ')'));
+        assert(sno_stats.prim[SNO_STAT_BAL].calls == 1 && sno_stats.prim[SNO_STAT_BAL].examined == 6);
+        assert(sno_stats.prim[SNO_STAT_BAL_MAX].calls == 0);
+
+        /* Keyword table and NULL subject */
+        sno_lits(&t, kw, 2);
+        sno_bind(&s, "put x");
+        assert(sno_oneof(&s, &t, &k) && k == 1);
+        assert(!sno_lit(NULL, "x"));
+        assert(sno_stats.prim[SNO_STAT_ONEOF].advanced == 3);
+        assert(sno_stats.prim[SNO_STAT_LIT].calls == 1 && sno_stats.prim[SNO_STAT_LIT].fail == 1);
+
+        /* Literals count the bytes compared: an 8-byte literal failing at its last byte read 8 */
+        sno_bind(&s, "DATE:SEQ DATE:SEP");
+        assert(!sno_lit(&s, "DATE:SEP") && sno_stats.prim[SNO_STAT_LIT].examined == 8);
+        assert(!sno_lit_ci(&s, "date:x") && sno_stats.prim[SNO_STAT_LIT_CI].examined == 6);
+        assert(!sno_lit(&s, "DATE:SEQ DATE:SEP!"));                  /* longer than the subject: no compare */
+        assert(sno_stats.prim[SNO_STAT_LIT].examined == 8);
+        assert(sno_lit(&s, "DATE:SEQ") && sno_stats.prim[SNO_STAT_LIT].examined == 16);
+        sno_bind(&s, "posX");
+        sno_lits(&t, pw, 2);
+        assert(!sno_oneof(&s, &t, &k));                             /* "post" probed to 'X' */
+        assert(sno_stats.prim[SNO_STAT_ONEOF].examined == 3 + 4);
+
+        /* Reverse scans read from the end: "/file" of "dir/file" */
+        sno_bind(&s, "dir/file");
+        assert(sno_rbreak(&s, "/"));
+        st = &sno_stats.prim[SNO_STAT_RBREAK];
+        assert(st->ok == 1 && st->advanced == 8 && st->examined == 5);
+        sno_bind(&s, "dir/file");
+        assert(!sno_rfind_lit(&s, "."));
+        assert(sno_stats.prim[SNO_STAT_RFIND_LIT].examined == 8);
+
+        assert(strcmp(sno_stats_name(SNO_STAT_SPAN_CSET), "sno_span_cset") == 0);
+        assert(strcmp(sno_stats_name(SNO_STAT_RFIND_LIT), "sno_rfind_lit") == 0);
+
+        sno_stats_reset();
+        assert(sno_stats.prim[SNO_STAT_CH].calls == 0 && sno_stats.prim[SNO_STAT_SPAN].examined == 0);
+    }
+#else
+    sno_bind(&s, "abc");
+    assert(sno_span(&s, SNO_LETTERS));
+#endif
+}
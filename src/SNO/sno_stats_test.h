@@ -0,0 +1,9 @@
+#ifndef SNO_STATS_TEST_H
+#define SNO_STATS_TEST_H
+
+#include "sno_stats.h"
+#include <stdio.h>
+
+void sno_stats_test();
+
+#endif
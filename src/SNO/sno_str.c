@@ -1,2 +1,176 @@
 #include "sno_str.h"
+#include "sno_num.h"
+#include "sno_xlat.h"
+#include <string.h>
 
+/* Default TRIM set */
+#define SNO_STR_BLANKS " \t\r\n"
+
+/* Length of common prefix of a[0..n) and b[0..n), one machine word per step */
+static size_t sno_str_common(cstr_t* a, cstr_t* b, size_t n)
+{
+    size_t i = 0, wa, wb;
+    for (; n - i >= sizeof(size_t); i += sizeof(size_t)) {
+        memcpy(&wa, a + i, sizeof(wa));                     /* unaligned-safe word loads */
+        memcpy(&wb, b + i, sizeof(wb));
+        if (wa != wb) break;
+    }
+    while (i < n && a[i] == b[i]) i++;
+    return i;
+}
+
+/* Bytes needed for x * n + 1, or 0 on overflow */
+static size_t sno_str_need(size_t x, size_t n)
+{
+    if (n && x > ((size_t)-1 - 1) / n) return 0;
+    return x * n + 1;
+}
+
+bool sno_view_eq(sno_view_t v, cstr_t* c)
+{
+    if (!c) return false;
+    size_t len = sno_view_size(v);
+    return strlen(c) == len && memcmp(v.begin, c, len) == 0;
+}
+
+int sno_view_cmp(sno_view_t a, sno_view_t b)
+{
+    return sno_str_compare(a, b);
+}
+
+bool sno_view_to_u32(sno_view_t v, uint32_t* out)
+{
+    if (!out || v.begin == v.end) return false;
+    uint32_t n = 0;
+    cstr_t* p;
+    for (p = v.begin; p < v.end; p++) {
+        unsigned d = (unsigned char)*p - '0';
+        if (d > 9) return false;                            /* not a digit */
+        if (n > (UINT32_MAX - d) / 10) return false;        /* overflow */
+        n = n * 10 + d;
+    }
+    *out = n;
+    return true;
+}
+
+bool sno_view_to_i64(sno_view_t v, int64_t* out)
+{
+    if (!out || v.begin == v.end) return false;
+    cstr_t* p = v.begin;
+    bool neg = (*p == '-');
+    if (neg || *p == '+') p++;
+    if (p == v.end) return false;                           /* sign only */
+    uint64_t limit = neg ? (uint64_t)INT64_MAX + 1 : (uint64_t)INT64_MAX;
+    uint64_t n = 0;
+    for (; p < v.end; p++) {
+        unsigned d = (unsigned char)*p - '0';
+        if (d > 9) return false;
+        if (n > (limit - d) / 10) return false;             /* overflow */
+        n = n * 10 + d;
+    }
+    *out = (neg && n) ? -(int64_t)(n - 1) - 1 : (int64_t)n;   /* INT64_MIN without overflow */
+    return true;
+}
+
+bool sno_view_to_double(sno_view_t v, double* out)
+{
+    sno_subject_t s = {0};
+    if (!out || !v.begin) return false;
+    sno_bind_view(&s, &v);                                  /* one syntax at every length, no locale */
+    return sno_float(&s, out) && sno_at_r(&s, 0);
+}
+
+/* === Equality and Comparison === */
+
+bool sno_str_equal(sno_view_t a, sno_view_t b)
+{
+    size_t n = sno_view_size(a);
+    return n == sno_view_size(b) && sno_str_common(a.begin, b.begin, n) == n;
+}
+
+int sno_str_compare(sno_view_t a, sno_view_t b)
+{
+    size_t la = sno_view_size(a), lb = sno_view_size(b);
+    size_t n = la < lb ? la : lb;
+    size_t i = sno_str_common(a.begin, b.begin, n);
+    if (i < n) return (unsigned char)a.begin[i] < (unsigned char)b.begin[i] ? -1 : 1;
+    return (la > lb) - (la < lb);
+}
+
+/* === Substitution === */
+
+bool sno_str_replace(char* dst, size_t cap, sno_view_t v, cstr_t* from, cstr_t* to)
+{
+    sno_xlat_t x;
+    size_t len = sno_view_size(v);
+    if (!dst || len >= cap || !sno_xlat(&x, from, to)) return false;
+    memmove(dst, v.begin, len);                             /* dst may be v.begin */
+    dst[len] = '\0';
+    sno_xlat_apply(dst, len, &x);
+    return true;
+}
+
+/* === Trimming === */
+
+sno_view_t sno_str_ltrim(sno_view_t v, cstr_t* set)
+{
+    if (!set) return v;
+    while (v.begin < v.end && *v.begin && strchr(set, *v.begin)) v.begin++;
+    return v;
+}
+
+sno_view_t sno_str_rtrim(sno_view_t v, cstr_t* set)
+{
+    if (!set) return v;
+    while (v.end > v.begin && v.end[-1] && strchr(set, v.end[-1])) v.end--;
+    return v;
+}
+
+sno_view_t sno_str_trim(sno_view_t v)
+{
+    return sno_str_rtrim(sno_str_ltrim(v, SNO_STR_BLANKS), SNO_STR_BLANKS);
+}
+
+/* === Repetition and Concatenation === */
+
+bool sno_str_dupl(char* dst, size_t cap, sno_view_t v, size_t n)
+{
+    size_t len = sno_view_size(v), need = sno_str_need(len, n), i;
+    if (!dst || !need || need > cap) return false;
+    for (i = 0; i < n; i++) memcpy(dst + i * len, v.begin, len);
+    dst[len * n] = '\0';
+    return true;
+}
+
+char* sno_str_dupl_arena(sno_arena_t* a, sno_view_t v, size_t n)
+{
+    size_t need = sno_str_need(sno_view_size(v), n);
+    char* dst;
+    if (!a || !need || need > a->size - a->used) return NULL;
+    dst = a->base + a->used;
+    sno_str_dupl(dst, need, v, n);
+    a->used += need;
+    return dst;
+}
+
+bool sno_str_cat2(char* dst, size_t cap, sno_view_t x, sno_view_t y)
+{
+    size_t lx = sno_view_size(x), ly = sno_view_size(y);
+    if (!dst || lx >= cap || ly >= cap - lx) return false;
+    memcpy(dst, x.begin, lx);
+    memcpy(dst + lx, y.begin, ly);
+    dst[lx + ly] = '\0';
+    return true;
+}
+
+char* sno_str_cat2_arena(sno_arena_t* a, sno_view_t x, sno_view_t y)
+{
+    char* dst;
+    size_t room;
+    if (!a) return NULL;
+    room = a->size - a->used;
+    dst = a->base + a->used;
+    if (!sno_str_cat2(dst, room, x, y)) return NULL;
+    a->used += sno_view_size(x) + sno_view_size(y) + 1;
+    return dst;
+}
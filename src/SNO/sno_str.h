@@ -1,21 +1,52 @@
 #ifndef SNO_STR_H
 #define SNO_STR_H
 
-// exact equality
-sno_str_equal 
-sno_str_differ
-
-// compare family — lexical comparison
+#include "sno.h"
+#include "sno_arena.h"
+#include <stdint.h>
 
 // span length (SNOBOL SIZE)
-sno_view_size 
+#define sno_view_size(v) ((size_t)((v).end - (v).begin))
+
+// exact equality against a null-terminated string
+bool sno_view_eq(sno_view_t v, cstr_t* c);
+
+// lexical comparison — <0, 0, >0 like strcmp; a proper prefix sorts first
+int sno_view_cmp(sno_view_t a, sno_view_t b);
+
+// numeric conversion — entire view must be consumed; false on empty, junk or overflow
+bool sno_view_to_u32(sno_view_t v, uint32_t* out);
+bool sno_view_to_i64(sno_view_t v, int64_t* out);
+// sno_float syntax at any length: decimal only (no inf/nan/hex), '.' in every locale, no whitespace
+bool sno_view_to_double(sno_view_t v, double* out);
+
+// exact equality (SNOBOL IDENT / DIFFER) — word-at-a-time
+bool sno_str_equal(sno_view_t a, sno_view_t b);
+#define sno_str_differ(a, b) (!sno_str_equal((a), (b)))
+
+// compare family — lexical comparison, word-at-a-time (SNOBOL LLT, LLE, LGT, LGE)
+int sno_str_compare(sno_view_t a, sno_view_t b);
+#define sno_str_lt(a, b) (sno_str_compare((a), (b)) < 0)
+#define sno_str_le(a, b) (sno_str_compare((a), (b)) <= 0)
+#define sno_str_gt(a, b) (sno_str_compare((a), (b)) > 0)
+#define sno_str_ge(a, b) (sno_str_compare((a), (b)) >= 0)
+
+// character substitution (SNOBOL REPLACE) — copy v into dst[0..cap) mapping from[i] → to[i];
+// from/to lengths must match, dst may be v.begin (in place). Builds a table per call:
+// for repeated pairs build a sno_xlat_t once and use sno_xlat_apply (sno_xlat.h)
+bool sno_str_replace(char* dst, size_t cap, sno_view_t v, cstr_t* from, cstr_t* to);
 
-// character substitution (SNOBOL REPLACE)
-sno_str_replace 
+// trim family configurable trimming (SNOBOL TRIM) — adjusted view, no copy
+sno_view_t sno_str_trim(sno_view_t v);                  // both ends, " \t\r\n"
+sno_view_t sno_str_ltrim(sno_view_t v, cstr_t* set);    // leading members of set
+sno_view_t sno_str_rtrim(sno_view_t v, cstr_t* set);    // trailing members of set
 
-// trim family configurable trimming (SNOBOL TRIM)
+// character repetition (SNOBOL DUPL) — n copies of v, NUL-terminated; needs size * n + 1 bytes
+bool sno_str_dupl(char* dst, size_t cap, sno_view_t v, size_t n);
+char* sno_str_dupl_arena(sno_arena_t* a, sno_view_t v, size_t n);
 
-// character repetition (SNOBOL DUPL)
-sno_str_dupl
+// concatenation — x then y, NUL-terminated; needs size(x) + size(y) + 1 bytes
+bool sno_str_cat2(char* dst, size_t cap, sno_view_t x, sno_view_t y);
+char* sno_str_cat2_arena(sno_arena_t* a, sno_view_t x, sno_view_t y);
 
 #endif
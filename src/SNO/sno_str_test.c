@@ -1,3 +1,170 @@
 #include "sno_str_test.h"
+#include "sno_constants.h"
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
 
+/* View over a whole C string */
+static sno_view_t view_of(cstr_t* c)
+{
+    sno_view_t v;
+    v.begin = c;
+    v.end = c + strlen(c);
+    return v;
+}
 
+void sno_str_test(void) {
+    sno_subject_t s = {0};
+    sno_view_t v, w;
+    uint32_t u;
+    int64_t i;
+    double d;
+
+    /* sno_cap_view: mark → cursor, no copy */
+    sno_bind(&s, "host=alpha");
+    sno_mark(&s);
+    assert(sno_span(&s, SNO_ALNUM_U));
+    v = sno_cap_view(&s);
+    assert(v.begin == s.str.begin);                 /* points into subject */
+    assert(sno_view_size(v) == 4);
+    assert(sno_view_eq(v, "host"));
+    assert(!sno_view_eq(v, "hos") && !sno_view_eq(v, "hosts") && !sno_view_eq(v, NULL));
+    assert(sno_ch(&s, '=') && sno_mark(&s) && sno_rem(&s));
+    w = sno_cap_view(&s);
+    assert(sno_view_eq(w, "alpha"));
+    assert(s.view.end == s.str.end);                /* cursor unchanged */
+    v = sno_cap_view(NULL);
+    assert(v.begin == NULL && sno_view_size(v) == 0);
+
+    /* sno_view_cmp: lexical order, prefix first */
+    sno_bind(&s, "abc abd ab");
+    assert(sno_len(&s, 3)); v = s.view;             /* "abc" */
+    assert(sno_len(&s, 1) && sno_len(&s, 3)); w = s.view;   /* "abd" */
+    assert(sno_view_cmp(v, w) < 0 && sno_view_cmp(w, v) > 0);
+    assert(sno_view_cmp(v, v) == 0);
+    assert(sno_len(&s, 1) && sno_rem(&s));          /* "ab" */
+    assert(sno_view_cmp(s.view, v) < 0 && sno_view_cmp(v, s.view) > 0);
+
+    /* sno_view_to_u32 */
+    sno_bind(&s, "port=8080;");
+    assert(sno_len(&s, 5) && sno_span(&s, SNO_DIGITS));
+    assert(sno_view_to_u32(s.view, &u) && u == 8080);
+    sno_bind(&s, "4294967295 4294967296 12a");
+    assert(sno_break(&s, " ") && sno_view_to_u32(s.view, &u) && u == 4294967295u);
+    u = 7;
+    assert(sno_len(&s, 1) && sno_break(&s, " ") && !sno_view_to_u32(s.view, &u));  /* overflow */
+    assert(u == 7);                                 /* out untouched on failure */
+    assert(sno_len(&s, 1) && sno_rem(&s) && !sno_view_to_u32(s.view, &u));         /* junk */
+    assert(sno_reset(&s) && !sno_view_to_u32(s.view, &u));                          /* empty */
+
+    /* sno_view_to_i64 */
+    sno_bind(&s, "-9223372036854775808 9223372036854775807 +42 - 9223372036854775808");
+    assert(sno_break(&s, " ") && sno_view_to_i64(s.view, &i) && i == INT64_MIN);
+    assert(sno_len(&s, 1) && sno_break(&s, " ") && sno_view_to_i64(s.view, &i) && i == INT64_MAX);
+    assert(sno_len(&s, 1) && sno_break(&s, " ") && sno_view_to_i64(s.view, &i) && i == 42);
+    assert(sno_len(&s, 1) && sno_break(&s, " ") && !sno_view_to_i64(s.view, &i));  /* sign only */
+    assert(sno_len(&s, 1) && sno_rem(&s) && !sno_view_to_i64(s.view, &i));         /* overflow */
+
+    /* sno_view_to_double */
+    sno_bind(&s, "3.25,-1e3, 2,2x");
+    assert(sno_break(&s, ",") && sno_view_to_double(s.view, &d) && d == 3.25);
+    assert(sno_len(&s, 1) && sno_break(&s, ",") && sno_view_to_double(s.view, &d) && d == -1000.0);
+    assert(sno_len(&s, 1) && sno_break(&s, ",") && !sno_view_to_double(s.view, &d));  /* leading space */
+    assert(sno_len(&s, 1) && sno_rem(&s) && !sno_view_to_double(s.view, &d));       /* "2x" junk */
+    assert(!sno_view_to_double(s.view, NULL));
+    sno_bind(&s, "1e999,-1e999,\n5,\r5,\v5,\f5,1e-999");
+    assert(sno_break(&s, ",") && !sno_view_to_double(s.view, &d));                   /* overflow */
+    assert(sno_len(&s, 1) && sno_break(&s, ",") && !sno_view_to_double(s.view, &d));
+    assert(sno_len(&s, 1) && sno_break(&s, ",") && !sno_view_to_double(s.view, &d));  /* leading newline */
+    assert(sno_len(&s, 1) && sno_break(&s, ",") && !sno_view_to_double(s.view, &d));
+    assert(sno_len(&s, 1) && sno_break(&s, ",") && !sno_view_to_double(s.view, &d));
+    assert(sno_len(&s, 1) && sno_break(&s, ",") && !sno_view_to_double(s.view, &d));
+    assert(sno_len(&s, 1) && sno_rem(&s) && sno_view_to_double(s.view, &d) && d == 0.0);  /* underflow */
+    {
+        static const char lng[] = "0.000000000000000000000000000000000000000000000000000000000000000000125";
+        sno_bind(&s, lng);
+        assert(sno_rem(&s) && sno_view_to_double(s.view, &d) && d == strtod(lng, NULL));   /* 64+ bytes */
+        sno_bind(&s, "0.0000000000000000000000000000000000000000000000000000000000000000001x");
+        assert(sno_rem(&s) && !sno_view_to_double(s.view, &d));
+    }
+    {
+        /* Same syntax short or long: padding with zeros never flips the answer */
+        static cstr_t* const bad[] = {"inf", "-nan", "0x1p3", "1,5", "1.5 "};
+        size_t k;
+        for (k = 0; k < sizeof(bad) / sizeof(bad[0]); k++) {
+            sno_bind(&s, bad[k]);
+            assert(sno_rem(&s) && !sno_view_to_double(s.view, &d));
+        }
+        sno_bind(&s, "0x10000000000000000000000000000000000000000000000000000000000000000000");
+        assert(sno_rem(&s) && !sno_view_to_double(s.view, &d));
+        sno_bind(&s, "1.50000000000000000000000000000000000000000000000000000000000000000000");
+        assert(sno_rem(&s) && sno_view_to_double(s.view, &d) && d == 1.5);
+        sno_bind(&s, "1.5");
+        assert(sno_rem(&s) && sno_view_to_double(s.view, &d) && d == 1.5);
+    }
+
+    /* sno_str_equal / sno_str_differ: word loop plus tail, any alignment */
+    {
+        static const char a[] = "the quick brown fox jumps over the lazy dog";
+        char b[sizeof(a) + 1];
+        size_t k;
+        memcpy(b + 1, a, sizeof(a));
+        assert(sno_str_equal(view_of(a), view_of(b + 1)));
+        assert(!sno_str_differ(view_of(a), view_of(b + 1)));
+        for (k = 0; k < sizeof(a) - 1; k++) {                     /* mismatch at every offset */
+            b[1 + k] ^= 1;
+            assert(sno_str_differ(view_of(a), view_of(b + 1)));
+            assert(sno_str_compare(view_of(a), view_of(b + 1)) == ((a[k] ^ 1) > a[k] ? -1 : 1));
+            b[1 + k] ^= 1;
+        }
+        assert(sno_str_differ(view_of("abc"), view_of("ab")));
+        assert(sno_str_equal(view_of(""), view_of("")));
+    }
+
+    /* compare family: unsigned bytes, prefix first */
+    assert(sno_str_lt(view_of("abc"), view_of("abd")) && sno_str_gt(view_of("abd"), view_of("abc")));
+    assert(sno_str_lt(view_of("ab"), view_of("abc")) && sno_str_ge(view_of("abc"), view_of("abc")));
+    assert(sno_str_le(view_of("abc"), view_of("abc")) && sno_str_gt(view_of("\xe9"), view_of("z")));
+    assert(sno_view_cmp(view_of("abcdefghij"), view_of("abcdefghik")) < 0);
+
+    /* sno_str_replace: one table per call, in place allowed */
+    {
+        char buf[16];
+        assert(sno_str_replace(buf, sizeof(buf), view_of("Hello, World"), "lo", "01"));
+        assert(strcmp(buf, "He001, W1r0d") == 0);
+        assert(sno_str_replace(buf, sizeof(buf), view_of(buf), "01", "lo"));
+        assert(strcmp(buf, "Hello, World") == 0);
+        assert(!sno_str_replace(buf, sizeof(buf), view_of("x"), "ab", "c"));      /* length mismatch */
+        assert(!sno_str_replace(buf, 4, view_of("abcd"), "a", "b"));              /* no room for '\0' */
+    }
+
+    /* trim family: adjusted views into the original */
+    v = sno_str_trim(view_of("  \t key = val \r\n"));
+    assert(sno_view_size(v) == 9 && sno_view_eq(v, "key = val"));
+    v = sno_str_ltrim(view_of("00420"), "0");
+    assert(sno_view_eq(v, "420"));
+    v = sno_str_rtrim(view_of("1.500"), "0");
+    assert(sno_view_eq(v, "1.5"));
+    v = sno_str_trim(view_of(" \t "));
+    assert(sno_view_size(v) == 0);
+
+    /* sno_str_dupl / sno_str_cat2: exact sizes, caller or arena buffers */
+    {
+        char buf[8];
+        static char block[16];
+        sno_arena_t a;
+        char* p;
+        assert(sno_str_dupl(buf, 7, view_of("ab"), 3) && strcmp(buf, "ababab") == 0);
+        assert(!sno_str_dupl(buf, 6, view_of("ab"), 3));
+        assert(sno_str_dupl(buf, 1, view_of("ab"), 0) && buf[0] == '\0');
+        assert(!sno_str_dupl(buf, sizeof(buf), view_of("ab"), (size_t)-1));      /* size overflow */
+        assert(sno_str_cat2(buf, 8, view_of("key"), view_of("=val")) && strcmp(buf, "key=val") == 0);
+        assert(!sno_str_cat2(buf, 7, view_of("key"), view_of("=val")));
+        sno_arena(&a, block, sizeof(block));
+        assert((p = sno_str_dupl_arena(&a, view_of("-"), 5)) && strcmp(p, "-----") == 0 && a.used == 6);
+        assert((p = sno_str_cat2_arena(&a, view_of("ab"), view_of("cd"))) && strcmp(p, "abcd") == 0);
+        assert(a.used == 11);
+        assert(!sno_str_cat2_arena(&a, view_of("abc"), view_of("de")) && a.used == 11);
+        assert(!sno_str_dupl_arena(&a, view_of("abc"), 2) && a.used == 11);
+    }
+}
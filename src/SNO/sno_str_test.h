@@ -1 +1,9 @@
-#
+#ifndef SNO_STR_TEST_H
+#define SNO_STR_TEST_H
+
+#include "sno_str.h"
+#include <stdio.h>
+
+void sno_str_test();
+
+#endif
@@ -0,0 +1,176 @@
+#include "sno_stream.h"
+#include "sno_scan.h"
+#include <stdio.h>
+#include <string.h>
+
+/* === Internal Helpers === */
+
+/* Shift window pointer p back by n; NULL (empty slot) stays NULL */
+#define sno_shift(p, n) ((p) = (p) ? (p) - (n) : (p))
+
+/* Oldest byte still referenced by the subject: mark, view.begin, open slots */
+static cstr_t* sno_stream_pin(const sno_subject_t* s)
+{
+    cstr_t* pin = s->mark < s->view.begin ? s->mark : s->view.begin;
+    size_t i;
+    for (i = 0; i < SNO_CAPS; i++) {
+        if (s->caps[i].begin && s->caps[i].begin < pin) pin = s->caps[i].begin;
+    }
+    return pin;
+}
+
+/*
+ * Compact pinned bytes to buf[0] and append one refill.
+ * False when nothing was added (end of input or window full of pinned bytes);
+ * subject pointers remain valid either way.
+ */
+static bool sno_stream_pull(sno_stream_t* st)
+{
+    sno_subject_t* s = &st->s;
+    cstr_t* pin;
+    size_t shift, keep, got, i;
+
+    if (st->eof) return false;
+    pin = sno_stream_pin(s);
+    shift = (size_t)(pin - st->buf);
+    keep = (size_t)(s->str.end - pin);
+    if (shift) {
+        memmove(st->buf, pin, keep);
+        s->str.end -= shift;
+        s->view.begin -= shift;
+        s->view.end -= shift;
+        s->mark -= shift;
+        for (i = 0; i < SNO_CAPS; i++) {
+            sno_shift(s->caps[i].begin, shift);
+            sno_shift(s->caps[i].end, shift);
+        }
+        st->base += shift;
+    }
+    s->length = keep;
+    if (keep == st->size) return false;
+    got = st->refill(st->ctx, st->buf + keep, st->size - keep);
+    if (got == 0) {
+        st->eof = true;
+        return false;
+    }
+    s->str.end += got;
+    s->length += got;
+    return true;
+}
+
+/*
+ * Shared SPAN/BREAK driver: rescan only bytes added since the last pull.
+ * Returns length of run from cursor; *full set when the window edge was hit
+ * with no room left to grow.
+ */
+static size_t sno_stream_run(sno_stream_t* st, const char* set, const sno_cset_t* cs,
+                             bool span, bool* full)
+{
+    sno_subject_t* s = &st->s;
+    size_t run = 0;
+    cstr_t* pos;
+
+    for (;;) {
+        pos = set ? sno_scan_set(s->view.end + run, s->str.end, set, span)
+                  : sno_scan_cset(s->view.end + run, s->str.end, cs, span);
+        run = (size_t)(pos - s->view.end);
+        if (pos < s->str.end) break;
+        if (!sno_stream_pull(st)) {                 /* pointers re-based; run still valid */
+            *full = !st->eof;
+            break;
+        }
+    }
+    return run;
+}
+
+/* Commit run as the new view; cursor advances */
+static bool sno_stream_take(sno_subject_t* s, size_t run)
+{
+    s->view.begin = s->view.end;
+    s->view.end += run;
+    return true;
+}
+
+/* === Stream Management === */
+
+void sno_stream(sno_stream_t* st, char* buf, size_t size, sno_refill_fn refill, void* ctx)
+{
+    if (!st || !buf || !refill) return;
+    st->buf = buf;
+    st->size = size;
+    st->base = 0;
+    st->refill = refill;
+    st->ctx = ctx;
+    st->eof = false;
+    sno_bind_n(&st->s, buf, 0);
+}
+
+bool sno_stream_need(sno_stream_t* st, size_t n)
+{
+    if (!st) return false;
+    while ((size_t)(st->s.str.end - st->s.view.end) < n) {
+        if (!sno_stream_pull(st)) return false;
+    }
+    return true;
+}
+
+bool sno_stream_release(sno_stream_t* st)
+{
+    size_t i;
+    if (!st) return false;
+    st->s.mark = st->s.view.begin = st->s.view.end;
+    for (i = 0; i < SNO_CAPS; i++) st->s.caps[i].begin = st->s.caps[i].end = NULL;
+    return true;
+}
+
+/* === Stream Primitives === */
+
+bool sno_stream_break(sno_stream_t* st, const char* set)
+{
+    bool full = false;
+    size_t run;
+    if (!st || !set) return false;
+    run = sno_stream_run(st, set, NULL, false, &full);
+    return !full && sno_stream_take(&st->s, run);
+}
+
+bool sno_stream_break_cset(sno_stream_t* st, const sno_cset_t* cs)
+{
+    bool full = false;
+    size_t run;
+    if (!st || !cs) return false;
+    run = sno_stream_run(st, NULL, cs, false, &full);
+    return !full && sno_stream_take(&st->s, run);
+}
+
+bool sno_stream_span(sno_stream_t* st, const char* set)
+{
+    bool full = false;
+    size_t run;
+    if (!st || !set) return false;
+    run = sno_stream_run(st, set, NULL, true, &full);
+    return !full && run > 0 && sno_stream_take(&st->s, run);
+}
+
+bool sno_stream_span_cset(sno_stream_t* st, const sno_cset_t* cs)
+{
+    bool full = false;
+    size_t run;
+    if (!st || !cs) return false;
+    run = sno_stream_run(st, NULL, cs, true, &full);
+    return !full && run > 0 && sno_stream_take(&st->s, run);
+}
+
+bool sno_stream_lit(sno_stream_t* st, cstr_t* lit)
+{
+    if (!st || !lit) return false;
+    sno_stream_need(st, strlen(lit));               /* short at EOF: sno_lit decides */
+    return sno_lit(&st->s, lit);
+}
+
+/* === Refill Sources === */
+
+size_t sno_refill_file(void* ctx, char* buf, size_t len)
+{
+    return ctx ? fread(buf, 1, len, (FILE*)ctx) : 0;
+}
@@ -0,0 +1,66 @@
+/* sno_stream.h — Streaming subjects over chunked input */
+
+#ifndef SNO_STREAM_H
+#define SNO_STREAM_H
+
+#include "sno.h"
+
+/**
+ * @file sno_stream.h
+ * @brief Sliding-window subject with a refill callback (files, sockets)
+ *
+ * The stream owns a fixed caller-provided window. Its embedded subject
+ * st->s always spans the bytes currently held: [buf, buf + fill). When a
+ * stream primitive reaches the window edge it compacts the window and calls
+ * refill for more bytes, so multi-megabyte inputs parse in constant memory.
+ *
+ * Bytes from the oldest of mark, view.begin and any open capture slot are
+ * pinned: compaction never discards them. Call sno_stream_release() once a
+ * record is done so the window can slide past it.
+ *
+ * Compaction moves bytes, so pointers into the window (views, marks) are
+ * adjusted for st->s only—copy out or re-read them after each stream call.
+ * Offsets used by sno_tab/sno_at are window-relative; st->base is the
+ * absolute stream offset of buf[0].
+ */
+
+/**
+ * Refill callback: write up to len bytes into buf, return the count.
+ * Returning 0 signals end of input.
+ */
+typedef size_t (*sno_refill_fn)(void* ctx, char* buf, size_t len);
+
+typedef struct {
+    sno_subject_t s;       /**< Subject over window contents; use for non-stream primitives */
+    char* buf;             /**< Window storage (caller-owned) */
+    size_t size;           /**< Window capacity in bytes */
+    size_t base;           /**< Absolute stream offset of buf[0] */
+    sno_refill_fn refill;  /**< Source of more bytes */
+    void* ctx;             /**< Passed to refill */
+    bool eof;              /**< refill reported end of input */
+} sno_stream_t;
+
+/** Initialize stream over window buf[0..size); no bytes are read until needed */
+void sno_stream(sno_stream_t* st, char* buf, size_t size, sno_refill_fn refill, void* ctx);
+
+/** Ensure ≥ n bytes after cursor; false at end of input or when pinned data fills the window */
+bool sno_stream_need(sno_stream_t* st, size_t n);
+
+/** Unpin everything before cursor: mark = cursor, capture slots cleared */
+bool sno_stream_release(sno_stream_t* st);
+
+/** Stream BREAK: pulls more input at the window edge; false only on NULL args or full window */
+bool sno_stream_break(sno_stream_t* st, const char* set);
+bool sno_stream_break_cset(sno_stream_t* st, const sno_cset_t* cs);
+
+/** Stream SPAN: pulls more input at the window edge; false on empty match or full window */
+bool sno_stream_span(sno_stream_t* st, const char* set);
+bool sno_stream_span_cset(sno_stream_t* st, const sno_cset_t* cs);
+
+/** Stream literal: pulls enough input to decide, then sno_lit */
+bool sno_stream_lit(sno_stream_t* st, cstr_t* lit);
+
+/** Refill callback reading from a stdio FILE* passed as ctx */
+size_t sno_refill_file(void* ctx, char* buf, size_t len);
+
+#endif
@@ -0,0 +1,102 @@
+#include "sno_stream_test.h"
+#include "sno_constants.h"
+#include "sno_str.h"
+#include <assert.h>
+#include <string.h>
+
+/* Refill source: serves a string in chunks of at most 'chunk' bytes */
+typedef struct {
+    const char* src;
+    size_t pos, chunk;
+} chunk_src_t;
+
+static size_t chunk_refill(void* ctx, char* buf, size_t len)
+{
+    chunk_src_t* c = (chunk_src_t*)ctx;
+    size_t n = strlen(c->src + c->pos);
+    if (n > c->chunk) n = c->chunk;
+    if (n > len) n = len;
+    memcpy(buf, c->src + c->pos, n);
+    c->pos += n;
+    return n;
+}
+
+void sno_stream_test(void) {
+    sno_stream_t st;
+    char win[16];
+    chunk_src_t src;
+    sno_view_t v;
+    size_t records = 0;
+
+    /* key=value records through a 16-byte window fed 3 bytes at a time */
+    src.src = "alpha=1\nbeta=22\ngamma=333\ndelta=4444\n";
+    src.pos = 0;
+    src.chunk = 3;
+    sno_stream(&st, win, sizeof(win), chunk_refill, &src);
+    assert(st.s.length == 0 && !st.eof);
+    while (sno_stream_need(&st, 1)) {
+        assert(sno_stream_span(&st, SNO_LETTERS));
+        v = st.s.view;
+        assert(sno_view_size(v) >= 4);
+        assert(sno_stream_lit(&st, "="));
+        sno_mark_n(&st.s, 0);
+        assert(sno_stream_break(&st, "\n"));
+        sno_cap_n(&st.s, 0);
+        assert(sno_view_size(st.s.caps[0]) == records + 1);         /* 1, 22, 333, 4444 */
+        assert(st.s.caps[0].begin[0] == (char)('1' + records));
+        assert(sno_stream_lit(&st, "\n"));
+        assert(sno_stream_release(&st));
+        records++;
+    }
+    assert(records == 4 && st.eof);
+    assert(st.base + st.s.length == strlen(src.src));               /* absolute offset tracked */
+
+    /* BREAK runs to end of input at EOF */
+    src.src = "no newline";
+    src.pos = 0;
+    sno_stream(&st, win, sizeof(win), chunk_refill, &src);
+    assert(sno_stream_break(&st, "\n"));
+    assert(sno_view_eq(st.s.view, "no newline"));
+    assert(!sno_stream_lit(&st, "\n"));
+    assert(!sno_stream_span(&st, SNO_LETTERS));                     /* empty: fails */
+
+    /* Token longer than window: fails, cursor unchanged */
+    src.src = "abcdefghijklmnopqrstuvwxyz;";
+    src.pos = 0;
+    sno_stream(&st, win, sizeof(win), chunk_refill, &src);
+    assert(!sno_stream_break(&st, ";"));
+    assert(st.s.view.end == st.s.str.begin && st.s.length == sizeof(win));
+
+    /* Released data slides out; pinned mark survives compaction */
+    src.src = "0123456789ABCDEFGHIJ;";
+    src.pos = 0;
+    sno_stream(&st, win, sizeof(win), chunk_refill, &src);
+    assert(sno_stream_need(&st, 10) && sno_len(&st.s, 10));
+    sno_stream_release(&st);
+    sno_mark(&st.s);
+    assert(sno_stream_break_cset(&st, &SNO_CSET_PUNCTUATION));
+    assert(st.base == 10);
+    v = sno_cap_view(&st.s);
+    assert(sno_view_eq(v, "ABCDEFGHIJ"));
+    assert(sno_stream_lit(&st, ";"));
+
+    /* stdio source */
+    {
+        FILE* f = tmpfile();
+        if (f) {
+            fputs("  42 ", f);
+            rewind(f);
+            sno_stream(&st, win, sizeof(win), sno_refill_file, f);
+            assert(sno_stream_span_cset(&st, &SNO_CSET_WHITESPACE));
+            assert(sno_stream_span_cset(&st, &SNO_CSET_DIGITS));
+            assert(sno_view_eq(st.s.view, "42"));
+            fclose(f);
+        }
+    }
+
+    /* NULL guards */
+    assert(!sno_stream_need(NULL, 1));
+    assert(!sno_stream_break(NULL, "x") && !sno_stream_break(&st, NULL));
+    assert(!sno_stream_span(NULL, "x") && !sno_stream_lit(&st, NULL));
+    assert(!sno_stream_release(NULL));
+}
@@ -0,0 +1,9 @@
+#ifndef SNO_STREAM_TEST_H
+#define SNO_STREAM_TEST_H
+
+#include "sno_stream.h"
+#include <stdio.h>
+
+void sno_stream_test();
+
+#endif
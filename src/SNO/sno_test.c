@@ -1,11 +1,14 @@
 /* sno_test.c */
 #include "sno.h"
 #include "sno_constants.h"
+#include "sno_inline.h"
+#include "sno_str.h"
 #include <assert.h>
 #include <string.h>
 
 void sno_test(void) {
     sno_subject_t s = {0};
+    sno_cset_t cs;
     char buf[64];
 
     /* sno_bind */
@@ -15,6 +18,64 @@ void sno_test(void) {
     assert(s.view.begin == s.str.begin);
     assert(s.view.end == s.str.begin);
     assert(s.length == 5);
+    assert(s.str.end == s.str.begin + 5);    // bound excludes terminator
+
+    /* sno_bind_n: slice of a larger buffer, no terminator required */
+    sno_bind_n(&s, "GET /index.html HTTP/1.1", 3);
+    assert(s.length == 3);
+    assert(s.str.end == s.str.begin + 3);
+    assert(!sno_lit(&s, "GET "));            // literal runs past bound → fail
+    assert(s.view.end == s.str.begin);
+    assert(sno_lit(&s, "GET"));
+    assert(sno_at_r(&s, 0));
+    assert(!sno_ch(&s, ' '));                // ' ' lies beyond bound
+    assert(!sno_len(&s, 1));
+    assert(!sno_any(&s, " "));
+    assert(!sno_notany(&s, "x"));
+
+    sno_bind_n(&s, "alpha beta", 8);         // "alpha be"
+    assert(sno_break(&s, "\n"));
+    assert(s.view.end == s.str.end);         // BREAK stops at bound
+    assert(sno_reset(&s) && sno_span(&s, "abehlp "));
+    assert(s.view.end == s.str.end);         // SPAN stops at bound
+    assert(sno_reset(&s) && sno_rem(&s));
+    assert(s.view.end - s.view.begin == 8);
+    assert(sno_reset(&s) && sno_rtab(&s, 2) && sno_at(&s, 6) && sno_at_r(&s, 2));
+    assert(!sno_tab(&s, 9));                 // beyond bound → fail
+
+    sno_bind_n(&s, "(a)b)", 2);              // "(a" – close lies beyond bound
+    assert(!sno_bal(&s, '(', ')'));
+    assert(s.view.end == s.str.begin);
+
+    /* Embedded NUL bytes are ordinary subject characters */
+    sno_bind_n(&s, "a\0b", 3);
+    assert(s.length == 3);
+    assert(sno_ch(&s, 'a'));
+    assert(!sno_any(&s, "ab"));              // '\0' is never a set member
+    assert(sno_notany(&s, "ab"));            // ... so NOTANY matches it
+    assert(sno_ch(&s, 'b') && sno_at_r(&s, 0));
+    sno_reset(&s);
+    assert(sno_break(&s, "b"));
+    assert(s.view.end - s.view.begin == 2);  // BREAK scans past '\0' to 'b'
+
+    sno_bind_n(&s, "", 0);
+    assert(s.length == 0 && sno_rem(&s) && s.view.begin == s.view.end);
+
+    /* sno_bind_view: parse a line of the parent in place */
+    {
+        sno_subject_t line = {0};
+        sno_bind(&s, "id=7 port=80\nnext");
+        assert(sno_break(&s, "\n"));             // isolate first line
+        sno_bind_view(&line, &s.view);
+        assert(line.str.begin == s.str.begin);   // no copy
+        assert(line.length == 12);
+        assert(sno_tab(&line, 5) && sno_lit(&line, "port="));
+        assert(sno_rtab(&line, 0) && sno_at_r(&line, 0) && sno_at(&line, 12));
+        assert(memcmp(line.view.begin, "80", 2) == 0);
+        assert(!sno_ch(&line, '\n'));            // parent's newline lies outside child
+        assert(sno_ch(&s, '\n'));                // parent cursor untouched by child
+        assert(strcmp(s.view.end, "next") == 0);
+    }
 
     /* sno_reset */
     sno_bind(&s, "abcdef");
@@ -83,7 +144,7 @@ void sno_test(void) {
     /* sno_break success — entire remainder */
     sno_bind(&s, "nospaces");
     assert(sno_break(&s, " "));
-    assert(s.view.end == s.str.end - 1);     // matched all (excluding '\0')
+    assert(s.view.end == s.str.end);         // matched all (str.end excludes '\0')
 
     /* sno_break stops at member */
     sno_bind(&s, "hello,world");
@@ -119,7 +180,7 @@ void sno_test(void) {
     assert(sno_span(&s, "ABCDEFGHIJKLMNOPQRSTUVWXYZ."));
     assert(sno_ch(&s, ' '));
     assert(sno_len(&s, 2));
-    assert(s.view.end == s.str.end - 1);     // consumed all (minus '\0')
+    assert(s.view.end == s.str.end);         // consumed all
 
     /* === sno_any === */
     sno_bind(&s, "alpha");
@@ -336,4 +397,352 @@ void sno_test(void) {
     assert(sno_ch(&s, ')'));          /* match closing paren */
     assert(strcmp(buf, "B(C)D") == 0);
 
+    /* sno_cset / _cset variants */
+
+    /* Bitmap membership mirrors set string */
+    sno_cset(&cs, "abc");
+    assert(sno_cset_has(&cs, 'a') && sno_cset_has(&cs, 'c'));
+    assert(!sno_cset_has(&cs, 'd'));
+    assert(!sno_cset_has(&cs, '\0'));
+    sno_cset(&cs, "\xff");                  /* high-bit bytes are members too */
+    assert(sno_cset_has(&cs, '\xff'));
+
+    /* Precompiled constants equal their string counterparts */
+    sno_cset(&cs, SNO_LETTERS);     assert(memcmp(&cs, &SNO_CSET_LETTERS, sizeof(cs)) == 0);
+    sno_cset(&cs, SNO_DIGITS);      assert(memcmp(&cs, &SNO_CSET_DIGITS, sizeof(cs)) == 0);
+    sno_cset(&cs, SNO_ALNUM);       assert(memcmp(&cs, &SNO_CSET_ALNUM, sizeof(cs)) == 0);
+    sno_cset(&cs, SNO_ALNUM_U);     assert(memcmp(&cs, &SNO_CSET_ALNUM_U, sizeof(cs)) == 0);
+    sno_cset(&cs, SNO_WHITESPACE);  assert(memcmp(&cs, &SNO_CSET_WHITESPACE, sizeof(cs)) == 0);
+    sno_cset(&cs, SNO_OPSYMS);      assert(memcmp(&cs, &SNO_CSET_OPSYMS, sizeof(cs)) == 0);
+    sno_cset(&cs, SNO_PUNCTUATION); assert(memcmp(&cs, &SNO_CSET_PUNCTUATION, sizeof(cs)) == 0);
+    sno_cset(&cs, SNO_HEX_DIGITS);  assert(memcmp(&cs, &SNO_CSET_HEX_DIGITS, sizeof(cs)) == 0);
+
+    /* Identifier scan with precompiled sets */
+    sno_bind(&s, "count_1=42");
+    sno_mark(&s);
+    assert(sno_any_cset(&s, &SNO_CSET_LETTERS));
+    assert(sno_span_cset(&s, &SNO_CSET_ALNUM_U));
+    assert(sno_cap(&s, buf, sizeof(buf)));
+    assert(strcmp(buf, "count_1") == 0);
+    assert(!sno_span_cset(&s, &SNO_CSET_DIGITS));   /* '=' not a digit → fail */
+    assert(s.view.end == s.str.begin + 7);          /* cursor unchanged */
+    assert(sno_notany_cset(&s, &SNO_CSET_DIGITS));  /* '=' */
+    assert(!sno_notany_cset(&s, &SNO_CSET_DIGITS)); /* '4' IS a digit → fail */
+    assert(sno_span_cset(&s, &SNO_CSET_DIGITS));    /* "42" */
+    assert(!sno_any_cset(&s, &SNO_CSET_DIGITS));    /* end of string → fail */
+    assert(!sno_notany_cset(&s, &SNO_CSET_DIGITS)); /* end of string → fail */
+
+    /* BREAK with bitmap: empty match, stop at member, entire remainder */
+    sno_bind(&s, "key = value\r\n");
+    assert(sno_break_cset(&s, &SNO_CSET_WHITESPACE));
+    assert(s.view.end - s.view.begin == 3);         /* "key" */
+    assert(sno_break_cset(&s, &SNO_CSET_WHITESPACE));
+    assert(s.view.begin == s.view.end);             /* zero-length at ' ' */
+    sno_cset(&cs, ";");
+    assert(sno_break_cset(&s, &cs));
+    assert(strcmp(s.view.begin, " = value\r\n") == 0 && *s.view.end == '\0');
+
+    assert(!sno_span_cset(NULL, &cs));
+    assert(!sno_break_cset(&s, NULL));
+
+    /* Long subjects: vector scan kernels agree with byte-at-a-time semantics */
+    {
+        static const char lines[] =
+            "abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyz0123456789"
+            "ABCDEFGHIJKLMNOPQRSTUVWXYZ;tail,\xe9\xe9\xe9\xe9\xe9\xe9\xe9\xe9\xe9\xe9\xe9\xe9\xe9\xe9\xe9\xe9"
+            "\xe9\xe9\xe9\xe9\xe9\xe9\xe9\xe9\xe9\xe9\xe9\xe9\xe9\xe9\xe9\xe9!\n";
+        size_t i;
+
+        sno_bind(&s, lines);
+        assert(sno_break(&s, ",;"));               /* small-set kernel */
+        assert(s.view.end - s.view.begin == 114);
+        sno_reset(&s);
+        assert(sno_break(&s, "\n"));
+        assert(s.view.end == s.str.end - 1);
+        sno_reset(&s);
+        assert(sno_span(&s, SNO_ALNUM));           /* large set string → bitmap */
+        assert(s.view.end - s.view.begin == 114);
+        sno_reset(&s);
+        assert(sno_span_cset(&s, &SNO_CSET_LETTERS));
+        assert(s.view.end - s.view.begin == 78);   /* stops at '0' */
+        assert(sno_break_cset(&s, &SNO_CSET_PUNCTUATION));
+        assert(*s.view.end == ';');
+        assert(sno_len(&s, 6));                    /* ";tail," */
+        sno_cset(&cs, "\xe9");
+        assert(sno_span_cset(&s, &cs));            /* high-bit members */
+        assert(s.view.end - s.view.begin == 32 && *s.view.end == '!');
+        assert(sno_span(&s, "!\n") && sno_at_r(&s, 0));
+
+        /* Every stop offset across block boundaries */
+        for (i = 0; i < 100; i++) {
+            sno_bind_n(&s, lines, i);              /* BREAK runs to bound */
+            assert(sno_break(&s, ",;") && s.view.end == s.str.end);
+            assert(sno_reset(&s) && sno_break_cset(&s, &SNO_CSET_PUNCTUATION) && s.view.end == s.str.end);
+            sno_bind(&s, lines + i);
+            assert(sno_span(&s, SNO_ALNUM_U) || i >= 114);
+            assert(s.str.begin + 114 - i == s.view.end || i >= 114);
+        }
+    }
+
+    /* sno_find_lit */
+    sno_bind(&s, "INFO ok; WARN disk; ERROR fan; ERROR psu");
+    assert(sno_find_lit(&s, "ERROR"));
+    assert(s.view.end - s.view.begin == 20);       /* skipped "INFO ok; WARN disk; " */
+    assert(sno_lit(&s, "ERROR"));
+    assert(sno_find_lit(&s, "ERROR") && sno_lit(&s, "ERROR ") && sno_rem(&s));
+    assert(strcmp(s.view.begin, "psu") == 0);
+    sno_reset(&s);
+    assert(!sno_find_lit(&s, "FATAL"));             /* absent → fail, cursor unchanged */
+    assert(s.view.end == s.str.begin);
+    assert(sno_find_lit(&s, "") && s.view.begin == s.view.end);
+    assert(sno_find_lit(&s, ";") && sno_at(&s, 7));  /* single char → memchr */
+    assert(!sno_find_lit(NULL, "x") && !sno_find_lit(&s, NULL));
+
+    sno_bind_n(&s, "abcERROR", 6);                   /* occurrence crosses bound */
+    assert(!sno_find_lit(&s, "ERROR"));
+    assert(sno_find_lit(&s, "ER") && sno_at(&s, 3));
+
+    /* Long haystack (Horspool) with near-misses and match at the very end */
+    {
+        static char hay[600];
+        memset(hay, 'E', sizeof(hay) - 1);
+        memcpy(hay + 100, "ERRORX", 6);
+        memcpy(hay + sizeof(hay) - 13, "ERRORZ", 6);
+        memcpy(hay + sizeof(hay) - 6, "ERROR", 5);
+        sno_bind(&s, hay);
+        assert(sno_find_lit(&s, "ERRORZ") && sno_at(&s, sizeof(hay) - 13));
+        assert(sno_find_lit(&s, "ERROR") && sno_at(&s, sizeof(hay) - 13));  /* already at one */
+        assert(sno_len(&s, 1) && sno_find_lit(&s, "ERROR") && sno_at_r(&s, 5));
+        sno_reset(&s);
+        assert(sno_find_lit(&s, "RORX") && sno_at(&s, 102));
+        assert(!sno_find_lit(&s, "EEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEX"));
+        assert(sno_at(&s, 102));
+    }
+
+    /* sno_bal: deep nesting needs no stack; sno_bal_max fails fast */
+    {
+        static char deep[20002];
+        memset(deep, '(', 10000);
+        memset(deep + 10000, ')', 10000);
+        sno_bind(&s, deep);
+        assert(sno_bal(&s, '(', ')') && sno_at_r(&s, 0));
+        sno_reset(&s);
+        assert(!sno_bal_max(&s, '(', ')', 9999));   /* one level too deep */
+        assert(s.view.end == s.str.begin);          /* rollback */
+        assert(sno_bal_max(&s, '(', ')', 10000) && sno_at_r(&s, 0));
+        deep[19999] = 'x';                          /* last close missing */
+        sno_reset(&s);
+        assert(!sno_bal(&s, '(', ')') && s.view.end == s.str.begin);
+    }
+    sno_bind(&s, "(a(b)c)(d)");
+    assert(!sno_bal_max(&s, '(', ')', 1));          /* nested pair exceeds 1 */
+    assert(sno_bal_max(&s, '(', ')', 2) && sno_at(&s, 7));
+    assert(sno_bal_max(&s, '(', ')', 1) && sno_at_r(&s, 0));
+    assert(!sno_bal_max(&s, '(', ')', 0));
+    sno_bind(&s, "'a(b'c");                         /* open == close pairs quotes */
+    assert(sno_bal(&s, '\'', '\'') && sno_at(&s, 5));
+
+    /* sno_bal_set / sno_bal_set_quoted: interleaved delimiter families */
+    sno_bind(&s, "{a:[1,(2)],b:{}}tail");
+    assert(sno_bal_set(&s, "([{", ")]}"));
+    assert(s.view.end - s.view.begin == 16 && *s.view.begin == '{');
+    assert(strcmp(s.view.end, "tail") == 0);
+    sno_bind(&s, "[(])");                            /* wrong interleaving */
+    assert(!sno_bal_set(&s, "([{", ")]}") && s.view.end == s.str.begin);
+    sno_bind(&s, "([)");
+    assert(!sno_bal_set(&s, "([{", ")]}"));
+    sno_bind(&s, "x()");
+    assert(!sno_bal_set(&s, "([{", ")]}"));          /* must start at an opener */
+    sno_bind(&s, "(]");
+    assert(!sno_bal_set(&s, "([{", ")]}"));
+    assert(!sno_bal_set(&s, "([", ")]}"));           /* unequal pair lists */
+    sno_bind(&s, "(\")\")");                         /* quote ignored without _quoted */
+    assert(sno_bal_set(&s, "(", ")") && sno_at(&s, 3));
+    sno_reset(&s);
+    assert(sno_bal_set_quoted(&s, "(", ")", "\"'") && sno_at_r(&s, 0));
+    sno_bind(&s, "(f(\"a)\\\"]\", ')'), 1)");        /* escapes and both quote kinds */
+    assert(sno_bal_set_quoted(&s, "([{", ")]}", "\"'") && sno_at_r(&s, 0));
+    sno_bind(&s, "(\"unterminated)");
+    assert(!sno_bal_set_quoted(&s, "(", ")", "\"") && s.view.end == s.str.begin);
+    {
+        static char deep[2 * SNO_BAL_DEPTH + 3];
+        memset(deep, '[', SNO_BAL_DEPTH);
+        memset(deep + SNO_BAL_DEPTH, ']', SNO_BAL_DEPTH);
+        sno_bind(&s, deep);
+        assert(sno_bal_set(&s, "([{", ")]}") && sno_at_r(&s, 0));
+        memmove(deep + 1, deep, 2 * SNO_BAL_DEPTH);
+        deep[2 * SNO_BAL_DEPTH + 1] = ']';
+        sno_bind(&s, deep);                          /* one level beyond stack → fail */
+        assert(!sno_bal_set(&s, "([{", ")]}") && s.view.end == s.str.begin);
+    }
+
+    /* Capture slots: whole record in one pass, N views back */
+    sno_bind(&s, "ts=1700000000 key=host val=alpha");
+    assert(sno_cap_view_n(&s, 0).begin == NULL);        /* cleared by bind */
+    assert(sno_lit(&s, "ts=") && sno_mark_n(&s, 0) && sno_span(&s, SNO_DIGITS) && sno_cap_n(&s, 0) &&
+           sno_lit(&s, " key=") && sno_mark_n(&s, 1) && sno_break(&s, " ") && sno_cap_n(&s, 1) &&
+           sno_lit(&s, " val=") && sno_mark_n(&s, 2) && sno_rem(&s) && sno_cap_n(&s, 2));
+    assert(memcmp(sno_cap_view_n(&s, 0).begin, "1700000000", 10) == 0);
+    assert(sno_cap_view_n(&s, 1).end - sno_cap_view_n(&s, 1).begin == 4);
+    assert(strcmp(sno_cap_view_n(&s, 2).begin, "alpha") == 0);
+    assert(!sno_mark_n(&s, SNO_CAPS) && !sno_cap_n(&s, SNO_CAPS));
+    assert(sno_cap_view_n(&s, SNO_CAPS).begin == NULL);
+    assert(!sno_cap_n(&s, 3));                          /* never opened */
+    sno_reset(&s);
+    assert(sno_cap_view_n(&s, 2).begin == NULL);        /* cleared by reset */
+
+    /* sno_rollback_n: failed group drops only its own slots */
+    {
+        cstr_t* start;
+        sno_bind(&s, "a=1;b=x");
+        assert(sno_mark_n(&s, 0) && sno_any(&s, SNO_LETTERS) && sno_cap_n(&s, 0));
+        start = s.view.end;
+        assert(sno_ch(&s, '=') && sno_mark_n(&s, 1));  /* group opens slot 1 ... */
+        assert(!sno_span(&s, SNO_LETTERS));             /* ... then fails on '1' */
+        assert(sno_mark_n(&s, 2));                      /* also opened after start */
+        assert(!sno_rollback_n(&s, start));
+        assert(s.view.end == start && s.view.begin == start);
+        assert(sno_cap_view_n(&s, 0).end == start);     /* kept: closed before start */
+        assert(sno_cap_view_n(&s, 1).begin == NULL);    /* dropped */
+        assert(sno_cap_view_n(&s, 2).begin == NULL);    /* dropped */
+
+        /* A mark set at the rollback point belongs to the enclosing group */
+        sno_bind(&s, "a");
+        assert(sno_mark_n(&s, 0));
+        start = s.view.end;
+        assert(!sno_ch(&s, 'x') && !sno_rollback_n(&s, start));   /* failed branch */
+        assert(sno_ch(&s, 'a') && sno_cap_n(&s, 0));
+        assert(sno_cap_view_n(&s, 0).begin == start && sno_cap_view_n(&s, 0).end == start + 1);
+    }
+
+    /* sno_lits / sno_oneof: keyword dispatch */
+    {
+        static cstr_t* const verbs[] = {"GET", "PUT", "POST", "GETALL", "PATCH", "DELETE", "\xff"};
+        sno_lits_t t;
+        size_t k = 99;
+        assert(sno_lits(&t, verbs, sizeof(verbs) / sizeof(verbs[0])));
+        sno_bind(&s, "GETALL /x");
+        assert(sno_oneof(&s, &t, &k) && k == 3);     /* longest match wins */
+        assert(s.view.end - s.view.begin == 6);
+        sno_bind(&s, "GETA /x");
+        assert(sno_oneof(&s, &t, &k) && k == 0 && sno_at(&s, 3));
+        sno_bind(&s, "PATCH");
+        assert(sno_oneof(&s, &t, NULL) && sno_at_r(&s, 0));
+        sno_bind(&s, "POS");                         /* truncated keyword */
+        assert(!sno_oneof(&s, &t, &k) && s.view.end == s.str.begin);
+        sno_bind_n(&s, "DELETE", 5);                 /* keyword runs past bound */
+        assert(!sno_oneof(&s, &t, &k));
+        sno_bind(&s, "HEAD");
+        assert(!sno_oneof(&s, &t, &k));
+        sno_bind(&s, "\xff!");
+        assert(sno_oneof(&s, &t, &k) && k == 6);     /* high-bit bucket */
+        sno_bind(&s, "");
+        assert(!sno_oneof(&s, &t, &k));
+        {
+            static cstr_t* const bad[] = {"ok", ""};
+            assert(!sno_lits(&t, bad, 2));           /* empty keyword rejected */
+            assert(!sno_lits(&t, verbs, SNO_LITS_MAX + 1));
+        }
+    }
+
+    /* Case-insensitive literals, csets and keyword tables */
+    sno_bind(&s, "Content-LENGTH: 42");
+    assert(sno_lit_ci(&s, "content-length") && sno_ch_ci(&s, ':'));
+    assert(s.view.end - s.view.begin == 1);
+    sno_bind(&s, "CONTENT");
+    assert(!sno_lit_ci(&s, "content-length") && s.view.end == s.str.begin);   /* past end */
+    assert(!sno_lit_ci(&s, "conteXt") && s.view.end == s.str.begin);
+    assert(sno_ch_ci(&s, 'c') && !sno_ch_ci(&s, 'x') && sno_ch_ci(&s, 'O'));
+    sno_bind(&s, "[{");                                             /* only letters fold */
+    assert(!sno_ch_ci(&s, '{') && !sno_lit_ci(&s, "{"));
+    assert(!sno_lit_ci(NULL, "a") && !sno_lit_ci(&s, NULL) && !sno_ch_ci(NULL, 'a'));
+    sno_cset_ci(&cs, "abcXYZ_");
+    assert(sno_cset_has(&cs, 'A') && sno_cset_has(&cs, 'a') && sno_cset_has(&cs, 'x'));
+    assert(sno_cset_has(&cs, '_') && !sno_cset_has(&cs, 'd') && !sno_cset_has(&cs, 'D'));
+    assert(!sno_cset_has(&cs, '\x7f') && !sno_cset_has(&cs, '@'));
+    sno_bind(&s, "CaBzYx_dd");
+    assert(sno_span_cset(&s, &cs) && sno_at(&s, 7));
+    {
+        static cstr_t* const hdrs[] = {"Host", "Content-Type", "Content-Length", "Accept", "X-"};
+        sno_lits_t t;
+        size_t k = 99;
+        assert(sno_lits_ci(&t, hdrs, 5) && t.ci);
+        sno_bind(&s, "content-length: 1");
+        assert(sno_oneof(&s, &t, &k) && k == 2);
+        sno_bind(&s, "HOST: a");
+        assert(sno_oneof(&s, &t, &k) && k == 0 && sno_at(&s, 4));
+        sno_bind(&s, "x-forwarded");
+        assert(sno_oneof(&s, &t, &k) && k == 4);
+        sno_bind(&s, "Acceptable");
+        assert(sno_oneof(&s, &t, &k) && k == 3);
+        sno_bind(&s, "Hos");
+        assert(!sno_oneof(&s, &t, &k));
+        assert(sno_lits(&t, hdrs, 5) && !t.ci);
+        sno_bind(&s, "HOST");
+        assert(!sno_oneof(&s, &t, &k));                            /* exact table stays exact */
+    }
+
+    /* Inline and unchecked variants agree with the out-of-line primitives */
+    sno_bind(&s, "id42 = x");
+    assert(sno_any_u(&s, SNO_LETTERS) && sno_notany_cset_u(&s, &SNO_CSET_DIGITS));
+    assert(!sno_ch_u(&s, 'x') && sno_any_cset_u(&s, &SNO_CSET_DIGITS) && sno_notany_u(&s, "="));
+    assert(sno_at(&s, 4) && sno_len_u(&s, 1) && sno_lit_u(&s, "= ") && sno_mark_u(&s));
+    assert(!sno_len_u(&s, 2) && s.mark == s.view.end && sno_rem_u(&s) && sno_at_r(&s, 0));
+    assert(!sno_tab_u(&s, 2) && sno_tab_u(&s, 8) && !sno_rtab_u(&s, 1) && sno_rtab_u(&s, 0));
+    sno_reset(&s);
+    assert(sno_rtab_u(&s, 2) && sno_at(&s, 6) && !sno_rtab_u(&s, 9));
+    assert(!sno_ch_inline(NULL, 'a') && !sno_lit_inline(&s, NULL) && !sno_mark_inline(NULL));
+    assert((sno_ch)(&s, ' ') && (sno_ch)(&s, 'x'));                  /* out-of-line symbol */
+
+    /* Reverse scans: suffix pieces from str.end, never before the cursor */
+    sno_bind(&s, "src/sno/sno.c");
+    assert(sno_rbreak(&s, "/") && sno_view_eq(s.view, "sno.c") && sno_at_r(&s, 0));
+    sno_bind(&s, "README");
+    assert(sno_rbreak(&s, ".") && sno_view_eq(s.view, "README"));    /* no member: whole rest */
+    sno_bind(&s, "file.tar.gz");
+    assert(sno_rfind_lit(&s, ".") && sno_at(&s, 9) && sno_rem(&s) && sno_view_eq(s.view, "gz"));
+    sno_bind(&s, "file.tar.gz");
+    assert(sno_rfind_lit(&s, ".tar") && sno_at(&s, 8) && sno_view_eq(s.view, ".tar"));
+    assert(!sno_rfind_lit(&s, ".tar") && sno_at(&s, 8));             /* before cursor: not seen */
+    sno_bind(&s, "README");
+    assert(!sno_rfind_lit(&s, ".") && sno_at(&s, 0) && s.view.end == s.view.begin);
+    assert(sno_rfind_lit(&s, "") && sno_at_r(&s, 0));                /* empty literal at end */
+
+    sno_bind(&s, "total=1234");
+    assert(sno_rspan(&s, SNO_DIGITS) && sno_view_eq(s.view, "1234"));
+    sno_bind(&s, "1234");
+    assert(sno_rspan(&s, SNO_DIGITS) && sno_view_eq(s.view, "1234"));  /* run reaches cursor */
+    sno_bind(&s, "total=12x");
+    assert(!sno_rspan(&s, SNO_DIGITS) && sno_at(&s, 0));
+    assert(sno_rspan_cset(&s, &SNO_CSET_LETTERS) && sno_view_eq(s.view, "x"));
+    sno_bind(&s, "MSG,4F*9C");
+    assert(sno_rbreak_cset(&s, &SNO_CSET_PUNCTUATION) == true && sno_view_eq(s.view, "4F*9C"));
+
+    /* sno_rtab bounds how far back they look */
+    sno_bind(&s, "a*b*checksum");
+    assert(sno_rtab(&s, 4) && !sno_rfind_lit(&s, "*") && sno_at(&s, 8));
+    sno_bind(&s, "a*b*sum");
+    assert(sno_rtab(&s, 4) && sno_rfind_lit(&s, "*") && sno_at(&s, 4));
+
+    /* ...but the anchor stays at str.end; rebinding the rtab prefix moves it */
+    {
+        sno_view_t head;
+        sno_bind(&s, "dir/name.ext;v2");
+        assert(sno_rtab(&s, 3) && sno_at(&s, 12) && sno_view_eq(s.view, "dir/name.ext"));
+        head = s.view;
+        assert(sno_rbreak(&s, "/;") && sno_view_eq(s.view, "v2") && sno_at_r(&s, 0));
+        sno_bind_view(&s, &head);
+        assert(sno_rbreak(&s, "/;") && sno_view_eq(s.view, "name.ext"));
+        assert(sno_at_r(&s, 0) && s.str.end == head.end);
+    }
+
+    /* Long range takes the bitmap path; single character and set paths agree */
+    sno_bind(&s, "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaxyzzyzyyzzyzz");
+    assert(sno_rspan(&s, "yz") && sno_view_eq(s.view, "yzzyzyyzzyzz"));
+    sno_reset(&s);
+    assert(sno_rbreak(&s, "ax") && sno_view_eq(s.view, "yzzyzyyzzyzz"));
+    sno_reset(&s);
+    assert(sno_rspan(&s, "z") && sno_view_eq(s.view, "zz"));
+    assert(!sno_rspan(NULL, "a") && !sno_rbreak(&s, NULL) && !sno_rfind_lit(&s, NULL));
+    assert(!sno_rspan_cset(&s, NULL) && !sno_rbreak_cset(NULL, &SNO_CSET_DIGITS));
 }
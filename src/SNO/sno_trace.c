@@ -0,0 +1,94 @@
+#include "sno_trace.h"
+#include <limits.h>
+#include <string.h>
+
+/* === Heatmap === */
+
+void sno_heat(sno_heat_t* h, unsigned* counts, size_t len)
+{
+    if (!h) return;
+    h->counts = counts;
+    h->len = counts ? len : 0;
+    h->events = h->examined = 0;
+    if (counts && len) memset(counts, 0, len * sizeof(*counts));
+}
+
+void sno_heat_event(void* ctx, unsigned prim, size_t start, size_t end, bool ok)
+{
+    sno_heat_t* h = (sno_heat_t*)ctx;
+    size_t i;
+    (void)prim;
+    (void)ok;
+    if (!h) return;
+    h->events++;
+    if (end > h->len) end = h->len;
+    for (i = start; i < end; i++) {
+        if (h->counts[i] < UINT_MAX) h->counts[i]++;       /* saturate */
+        h->examined++;
+    }
+}
+
+unsigned sno_heat_max(const sno_heat_t* h, size_t* offset)
+{
+    unsigned max = 0;
+    size_t i, at = 0;
+    if (!h) return 0;
+    for (i = 0; i < h->len; i++) {
+        if (h->counts[i] > max) {
+            max = h->counts[i];
+            at = i;
+        }
+    }
+    if (offset) *offset = at;
+    return max;
+}
+
+void sno_heat_print(const sno_heat_t* h, cstr_t* text, size_t width, FILE* f)
+{
+    size_t row, i, at;
+    unsigned max;
+    if (!h || !f) return;
+    if (!width) width = 64;
+    max = sno_heat_max(h, &at);
+    fprintf(f, "%lu bytes, %lu examined (%.2f per byte), max %u at offset %lu\n",
+            (unsigned long)h->len, h->examined, h->len ? (double)h->examined / (double)h->len : 0.0,
+            max, (unsigned long)at);
+    if (!text) return;
+    for (row = 0; row < h->len; row += width) {
+        size_t n = h->len - row < width ? h->len - row : width;
+        for (i = 0; i < n; i++) {
+            unsigned char c = (unsigned char)text[row + i];
+            fputc(c >= ' ' && c < 0x7F ? c : '.', f);           /* control bytes as '.' */
+        }
+        fputc('\n', f);
+        for (i = 0; i < n; i++) {
+            unsigned k = h->counts[row + i];
+            fputc(k == 0 ? ' ' : k > 9 ? '+' : (int)('0' + k), f);
+        }
+        fputc('\n', f);
+    }
+}
+
+/* === Trace Hook === */
+
+#ifdef SNO_TRACE
+
+static struct {
+    const sno_subject_t* s;    /* subject followed; NULL = all */
+    sno_trace_fn fn;
+    void* ctx;
+} sno_tracer;
+
+void sno_trace(const sno_subject_t* s, sno_trace_fn fn, void* ctx)
+{
+    sno_tracer.s = s;
+    sno_tracer.fn = fn;
+    sno_tracer.ctx = ctx;
+}
+
+void sno_trace_event(const sno_subject_t* s, unsigned prim, size_t start, size_t end, bool ok)
+{
+    if (sno_tracer.fn && (!sno_tracer.s || sno_tracer.s == s)) sno_tracer.fn(sno_tracer.ctx, prim, start, end, ok);
+}
+
+#endif
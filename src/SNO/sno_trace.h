@@ -0,0 +1,65 @@
+/* sno_trace.h — Per-primitive trace hook and "times examined" heatmap */
+
+#ifndef SNO_TRACE_H
+#define SNO_TRACE_H
+
+#include "sno.h"
+#include "sno_stats.h"
+#include <stdio.h>
+
+/**
+ * @file sno_trace.h
+ * @brief Find where a grammar re-reads the same bytes
+ *
+ * Build the library with -DSNO_TRACE and each primitive hooked by SNO_STATS
+ * reports (primitive id, start, end, success) to the trace callback, where
+ * [start, end) is the byte range it examined as offsets from that subject's
+ * str.begin. Like the sno_stats counters, the tracer is program state, not
+ * a subject field, so sno_subject_t has one layout in every build and
+ * rebinding the traced subject keeps the trace. One tracer at a time:
+ * trace sno_parallel_records runs with nthreads = 1.
+ *
+ * sno_heat_event is a ready-made callback that adds every event to a
+ * per-offset count. A linear parse reads most bytes once; offsets read many
+ * times mark || chains that rescan the same text and are worth rewriting
+ * with csets, sno_oneof or sno_memo. The heatmap works in any build: feed
+ * sno_heat_event directly to aggregate events from elsewhere.
+ */
+
+/** Trace callback: primitive (sno_stat_id_t), examined range [start, end), outcome */
+typedef void (*sno_trace_fn)(void* ctx, unsigned prim, size_t start, size_t end, bool ok);
+
+typedef struct {
+    unsigned* counts;          /**< counts[i] = times offset i was examined (caller array) */
+    size_t len;                /**< Entries in counts (subject length) */
+    unsigned long events;      /**< Events aggregated */
+    unsigned long examined;    /**< Sum of all counts */
+} sno_heat_t;
+
+/** Initialize heatmap over counts[0..len), zeroed */
+void sno_heat(sno_heat_t* h, unsigned* counts, size_t len);
+
+/** Trace callback (ctx = sno_heat_t*): count [start, end) once, clamped to len */
+void sno_heat_event(void* ctx, unsigned prim, size_t start, size_t end, bool ok);
+
+/** Highest count; its first offset in *offset (optional) */
+unsigned sno_heat_max(const sno_heat_t* h, size_t* offset);
+
+/** Summary line, then text[0..len) in rows of width with a count digit under each byte ('+' > 9) */
+void sno_heat_print(const sno_heat_t* h, cstr_t* text, size_t width, FILE* f);
+
+#ifdef SNO_TRACE
+
+/** Trace primitives run on subject s (NULL = every subject) with fn(ctx, …); fn = NULL stops */
+void sno_trace(const sno_subject_t* s, sno_trace_fn fn, void* ctx);
+
+/** Pass one event to the tracer if it follows s (called by sno_stats_record) */
+void sno_trace_event(const sno_subject_t* s, unsigned prim, size_t start, size_t end, bool ok);
+
+#else
+
+#define sno_trace(s, fn, ctx) ((void)0)
+
+#endif
+
+#endif
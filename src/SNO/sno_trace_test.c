@@ -0,0 +1,95 @@
+#include "sno_trace_test.h"
+#include "sno_constants.h"
+#include <assert.h>
+#include <string.h>
+
+#ifdef SNO_TRACE
+typedef struct {
+    unsigned prim[8];
+    size_t start[8], end[8];
+    bool ok[8];
+    size_t n;
+} trace_log_t;
+
+static void log_event(void* ctx, unsigned prim, size_t start, size_t end, bool ok)
+{
+    trace_log_t* log = (trace_log_t*)ctx;
+    if (log->n < 8) {
+        log->prim[log->n] = prim;
+        log->start[log->n] = start;
+        log->end[log->n] = end;
+        log->ok[log->n] = ok;
+    }
+    log->n++;
+}
+#endif
+
+void sno_trace_test()
+{
+    sno_heat_t h;
+    unsigned counts[8];
+    size_t at;
+
+    /* Heatmap aggregation works in every build */
+    sno_heat(&h, counts, 8);
+    assert(h.events == 0 && h.examined == 0 && counts[0] == 0 && counts[7] == 0);
+    sno_heat_event(&h, SNO_STAT_LIT, 0, 1, false);
+    sno_heat_event(&h, SNO_STAT_LIT, 0, 3, true);
+    sno_heat_event(&h, SNO_STAT_SPAN, 2, 20, true);          /* clamped to len */
+    assert(h.events == 3 && h.examined == 1 + 3 + 6);
+    assert(counts[0] == 2 && counts[1] == 1 && counts[2] == 2 && counts[7] == 1);
+    assert(sno_heat_max(&h, &at) == 2 && at == 0);
+    sno_heat_event(NULL, 0, 0, 1, true);                     /* NULL ctx ignored */
+
+    sno_heat(&h, NULL, 5);
+    assert(h.len == 0 && sno_heat_max(&h, NULL) == 0);
+
+#ifdef SNO_TRACE
+    {
+        sno_subject_t s = {0};
+        trace_log_t log = {{0}, {0}, {0}, {0}, 0};
+        unsigned heat[5];
+
+        /* Events carry id, examined range and outcome */
+        sno_bind(&s, "GET x");
+        sno_trace(&s, log_event, &log);
+        assert(sno_lit(&s, "PUT") || sno_lit(&s, "POST") || sno_lit(&s, "GET"));
+        assert(log.n == 3);
+        assert(log.prim[0] == SNO_STAT_LIT && log.start[0] == 0 && log.end[0] == 1 && !log.ok[0]);
+        assert(log.prim[2] == SNO_STAT_LIT && log.start[2] == 0 && log.end[2] == 3 && log.ok[2]);
+        assert(sno_span(&s, " ") && log.n == 4);
+        assert(log.prim[3] == SNO_STAT_SPAN && log.start[3] == 3 && log.end[3] == 5);
+
+        /* Reverse scans report the range read back from the end */
+        sno_bind(&s, "dir/file");
+        sno_trace(&s, log_event, &log);
+        assert(sno_rbreak(&s, "/") && log.n == 5);
+        assert(log.prim[4] == SNO_STAT_RBREAK && log.start[4] == 3 && log.end[4] == 8 && log.ok[4]);
+        log.n = 4;
+
+        /* Rebinding keeps the trace; other subjects are not followed unless s = NULL */
+        sno_bind(&s, "GET x");
+        assert(sno_lit(&s, "GET") && log.n == 5 && log.start[4] == 0 && log.end[4] == 3);
+        {
+            sno_subject_t other = {0};
+            sno_bind(&other, "x");
+            assert(sno_ch(&other, 'x') && log.n == 5);
+            sno_trace(NULL, log_event, &log);
+            sno_bind(&other, "x");
+            assert(sno_ch(&other, 'x') && log.n == 6 && log.prim[5] == SNO_STAT_CH);
+        }
+        log.n = 4;
+
+        /* Heatmap through the hook: the first byte is read by all three alternatives */
+        sno_bind(&s, "GET x");
+        sno_heat(&h, heat, 5);
+        sno_trace(&s, sno_heat_event, &h);
+        assert(sno_lit(&s, "PUT") || sno_lit(&s, "POST") || sno_lit(&s, "GET"));
+        assert(heat[0] == 3 && heat[1] == 1 && heat[2] == 1 && heat[3] == 0);
+        assert(h.events == 3 && h.examined == 5);
+
+        sno_trace(&s, NULL, NULL);
+        assert(sno_rem(&s) && h.events == 3);
+    }
+#endif
+}
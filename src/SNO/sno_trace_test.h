@@ -0,0 +1,9 @@
+#ifndef SNO_TRACE_TEST_H
+#define SNO_TRACE_TEST_H
+
+#include "sno_trace.h"
+#include <stdio.h>
+
+void sno_trace_test();
+
+#endif
@@ -0,0 +1,145 @@
+/* sno_xlat.c — Translation passes: SIMD range/pair kernels on hosts, scalar table on 8086 */
+#include "sno_xlat.h"
+#include <string.h>
+
+#if !defined(SNO_NO_SIMD) && defined(__GNUC__) && \
+    (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+#define SNO_XLAT_X86 1
+#include <emmintrin.h>
+#elif !defined(SNO_NO_SIMD) && defined(__GNUC__) && defined(__aarch64__) && defined(__ARM_NEON)
+#define SNO_XLAT_NEON 1
+#include <arm_neon.h>
+#endif
+
+/* === Scalar Reference (8086 target, tails, and TABLE class) === */
+
+static void xlat_table(unsigned char* p, size_t len, const sno_xlat_t* t)
+{
+    size_t i;
+    for (i = 0; i < len; i++) p[i] = t->map[p[i]];
+}
+
+/*
+ * Vector kernels translate whole 16-byte blocks and return the bytes done;
+ * the scalar table finishes the tail. Pair blends test the ORIGINAL bytes so
+ * the map applies simultaneously, exactly like the table.
+ */
+
+#if defined(SNO_XLAT_X86)
+
+static size_t xlat_range(unsigned char* p, size_t len, const sno_xlat_t* t)
+{
+    const __m128i lo = _mm_set1_epi8((char)t->lo), width = _mm_set1_epi8((char)(t->hi - t->lo));
+    const __m128i delta = _mm_set1_epi8((char)t->delta);
+    size_t i;
+    for (i = 0; len - i >= 16; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(p + i));
+        __m128i off = _mm_sub_epi8(v, lo);
+        __m128i in = _mm_cmpeq_epi8(_mm_min_epu8(off, width), off);   /* off ≤ width, unsigned */
+        _mm_storeu_si128((__m128i*)(p + i), _mm_add_epi8(v, _mm_and_si128(in, delta)));
+    }
+    return i;
+}
+
+static size_t xlat_pairs(unsigned char* p, size_t len, const sno_xlat_t* t)
+{
+    size_t i, k;
+    for (i = 0; len - i >= 16; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(p + i)), out = v;
+        for (k = 0; k < t->n; k++) {
+            __m128i m = _mm_cmpeq_epi8(v, _mm_set1_epi8((char)t->from[k]));
+            out = _mm_or_si128(_mm_and_si128(m, _mm_set1_epi8((char)t->to[k])), _mm_andnot_si128(m, out));
+        }
+        _mm_storeu_si128((__m128i*)(p + i), out);
+    }
+    return i;
+}
+
+#elif defined(SNO_XLAT_NEON)
+
+static size_t xlat_range(unsigned char* p, size_t len, const sno_xlat_t* t)
+{
+    const uint8x16_t lo = vdupq_n_u8(t->lo), width = vdupq_n_u8((unsigned char)(t->hi - t->lo));
+    const uint8x16_t delta = vdupq_n_u8(t->delta);
+    size_t i;
+    for (i = 0; len - i >= 16; i += 16) {
+        uint8x16_t v = vld1q_u8(p + i);
+        uint8x16_t in = vcleq_u8(vsubq_u8(v, lo), width);
+        vst1q_u8(p + i, vaddq_u8(v, vandq_u8(in, delta)));
+    }
+    return i;
+}
+
+static size_t xlat_pairs(unsigned char* p, size_t len, const sno_xlat_t* t)
+{
+    size_t i, k;
+    for (i = 0; len - i >= 16; i += 16) {
+        uint8x16_t v = vld1q_u8(p + i), out = v;
+        for (k = 0; k < t->n; k++) {
+            out = vbslq_u8(vceqq_u8(v, vdupq_n_u8(t->from[k])), vdupq_n_u8(t->to[k]), out);
+        }
+        vst1q_u8(p + i, out);
+    }
+    return i;
+}
+
+#else
+
+#define xlat_range(p, len, t) ((size_t)0)
+#define xlat_pairs(p, len, t) ((size_t)0)
+
+#endif
+
+/* === Building === */
+
+bool sno_xlat(sno_xlat_t* t, cstr_t* from, cstr_t* to)
+{
+    size_t c, changed = 0, first = 256, last = 0;
+    bool shift = true;
+    if (!t || !from || !to || strlen(from) != strlen(to)) return false;
+    for (c = 0; c < 256; c++) t->map[c] = (unsigned char)c;
+    while (*from) t->map[(unsigned char)*from++] = (unsigned char)*to++;
+
+    t->n = 0;
+    for (c = 0; c < 256; c++) {
+        if (t->map[c] == c) continue;
+        if (changed < SNO_XLAT_SMALL) {
+            t->from[changed] = (unsigned char)c;
+            t->to[changed] = t->map[c];
+        }
+        if (changed == 0) t->delta = (unsigned char)(t->map[c] - c);
+        else if ((unsigned char)(t->map[c] - c) != t->delta || c != last + 1) shift = false;
+        if (first == 256) first = c;
+        last = c;
+        changed++;
+    }
+
+    if (changed == 0) t->kind = SNO_XLAT_IDENT;
+    else if (shift) {
+        t->kind = SNO_XLAT_RANGE;
+        t->lo = (unsigned char)first;
+        t->hi = (unsigned char)last;
+    }
+    else if (changed <= SNO_XLAT_SMALL) {
+        t->kind = SNO_XLAT_PAIRS;
+        t->n = (unsigned char)changed;
+    }
+    else t->kind = SNO_XLAT_TABLE;
+    return true;
+}
+
+/* === Translation === */
+
+void sno_xlat_apply(char* buf, size_t len, const sno_xlat_t* t)
+{
+    unsigned char* p = (unsigned char*)buf;
+    size_t done = 0;
+    if (!buf || !t) return;
+    switch (t->kind) {
+    case SNO_XLAT_IDENT: return;
+    case SNO_XLAT_RANGE: done = xlat_range(p, len, t); break;
+    case SNO_XLAT_PAIRS: done = xlat_pairs(p, len, t); break;
+    default: break;
+    }
+    xlat_table(p + done, len - done, t);
+}
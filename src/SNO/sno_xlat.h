@@ -0,0 +1,44 @@
+/* sno_xlat.h — Reusable translation tables (SNOBOL REPLACE) */
+
+#ifndef SNO_XLAT_H
+#define SNO_XLAT_H
+
+#include "sno.h"
+
+/**
+ * @file sno_xlat.h
+ * @brief Build a from/to character map once, apply it in place many times
+ *
+ * sno_xlat() builds the 256-entry map and classifies it so sno_xlat_apply()
+ * can take the cheapest pass:
+ *   - identity: nothing to do
+ *   - range shift: one contiguous range moved by a constant (e.g. A-Z → a-z);
+ *     one subtract/compare/add per 16 bytes on SSE2/NEON hosts
+ *   - small: ≤ SNO_XLAT_SMALL changed characters; one compare/blend per pair
+ *     per 16 bytes on SSE2/NEON hosts
+ *   - table: anything else; scalar lookup (also used on the 8086 target)
+ * Every class produces exactly the same bytes as the scalar table.
+ */
+
+#ifndef SNO_XLAT_SMALL
+#define SNO_XLAT_SMALL 8   /* Max changed characters for the compare/blend pass */
+#endif
+
+enum { SNO_XLAT_IDENT, SNO_XLAT_RANGE, SNO_XLAT_PAIRS, SNO_XLAT_TABLE };
+
+typedef struct {
+    unsigned char map[256];                 /**< map[c] = translation of c */
+    unsigned char kind;                     /**< SNO_XLAT_* class chosen by sno_xlat */
+    unsigned char n;                        /**< PAIRS: number of changed characters */
+    unsigned char from[SNO_XLAT_SMALL];     /**< PAIRS: changed characters */
+    unsigned char to[SNO_XLAT_SMALL];       /**< PAIRS: their translations */
+    unsigned char lo, hi, delta;            /**< RANGE: [lo, hi] += delta (mod 256) */
+} sno_xlat_t;
+
+/** Build table mapping from[i] → to[i] (later pairs win); false when lengths differ */
+bool sno_xlat(sno_xlat_t* t, cstr_t* from, cstr_t* to);
+
+/** Translate buf[0..len) in place */
+void sno_xlat_apply(char* buf, size_t len, const sno_xlat_t* t);
+
+#endif
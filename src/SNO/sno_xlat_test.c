@@ -0,0 +1,56 @@
+#include "sno_xlat_test.h"
+#include <assert.h>
+#include <string.h>
+
+/* Apply t to every length/offset of a 0..255 ramp and compare with the raw map */
+static void xlat_check(const sno_xlat_t* t)
+{
+    static char buf[300];
+    size_t i, off, len;
+    for (off = 0; off < 3; off++) {
+        for (len = 0; len + off <= sizeof(buf); len += 37) {
+            for (i = 0; i < sizeof(buf); i++) buf[i] = (char)(i * 7);
+            sno_xlat_apply(buf + off, len, t);
+            for (i = 0; i < sizeof(buf); i++) {
+                unsigned char c = (unsigned char)(i * 7);
+                bool inside = i >= off && i < off + len;
+                assert((unsigned char)buf[i] == (inside ? t->map[c] : c));
+            }
+        }
+    }
+}
+
+void sno_xlat_test(void) {
+    sno_xlat_t t;
+    char buf[64];
+
+    /* Range shift: case folding */
+    assert(sno_xlat(&t, "ABCDEFGHIJKLMNOPQRSTUVWXYZ", "abcdefghijklmnopqrstuvwxyz"));
+    assert(t.kind == SNO_XLAT_RANGE && t.lo == 'A' && t.hi == 'Z' && t.delta == 32);
+    strcpy(buf, "GET /Index.HTML HTTP/1.1 Host: EXAMPLE.com");
+    sno_xlat_apply(buf, strlen(buf), &t);
+    assert(strcmp(buf, "get /index.html http/1.1 host: example.com") == 0);
+    xlat_check(&t);
+
+    /* Wrapping range, small pair map, later pair wins */
+    assert(sno_xlat(&t, "\xfe\xff", "\x01\x02") && t.kind == SNO_XLAT_RANGE);
+    xlat_check(&t);
+    assert(sno_xlat(&t, "\\/:x", "/.-y") && t.kind == SNO_XLAT_PAIRS && t.n == 4);
+    strcpy(buf, "C:\\DOS\\COMMAND.COM x");
+    sno_xlat_apply(buf, strlen(buf), &t);
+    assert(strcmp(buf, "C-/DOS/COMMAND.COM y") == 0);
+    xlat_check(&t);
+    assert(sno_xlat(&t, "aa", "bc") && t.map['a'] == 'c' && t.kind == SNO_XLAT_RANGE);
+
+    /* Swap is not a shift; large irregular map falls back to table */
+    assert(sno_xlat(&t, "ab", "ba") && t.kind == SNO_XLAT_PAIRS);
+    xlat_check(&t);
+    assert(sno_xlat(&t, "0123456789", "9876543210") && t.kind == SNO_XLAT_TABLE);
+    xlat_check(&t);
+
+    /* Identity, bad args */
+    assert(sno_xlat(&t, "abc", "abc") && t.kind == SNO_XLAT_IDENT);
+    xlat_check(&t);
+    assert(!sno_xlat(&t, "ab", "a") && !sno_xlat(NULL, "a", "b") && !sno_xlat(&t, NULL, "b"));
+    sno_xlat_apply(NULL, 4, &t);
+}
@@ -0,0 +1,9 @@
+#ifndef SNO_XLAT_TEST_H
+#define SNO_XLAT_TEST_H
+
+#include "sno_xlat.h"
+#include <stdio.h>
+
+void sno_xlat_test();
+
+#endif
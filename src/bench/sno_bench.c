@@ -0,0 +1,474 @@
+/* sno_bench.c — Primitive and example-parser throughput (ns/byte, records/sec) */
+
+#if defined(__unix__) || defined(__APPLE__)
+#define _POSIX_C_SOURCE 199309L   /* clock_gettime */
+#endif
+
+#include "sno.h"
+#include "sno_batch.h"
+#include "sno_constants.h"
+#include "sno_lines.h"
+#include "sno_num.h"
+#include "sno_split.h"
+#include "sno_str.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * @file sno_bench.c
+ * @brief Times each primitive and the README example parsers over corpora of several sizes
+ *
+ * Usage: sno_bench [-q] [-r] [file ...]
+ *   -q    quick: smallest corpora, short runs (smoke test)
+ *   -r    run-count mode: report runs completed per timing window instead of
+ *         ns/byte (default on DOS, where clock() ticks every 55 ms)
+ *   file  also run the line parsers over real-world text files
+ *
+ * Each case is repeated, doubling the count, until it has run for at least
+ * the timing window, so short cases are measured as accurately as long ones.
+ */
+
+#if defined(__DOS__)
+#define BENCH_CORPUS_MAX 16384UL     /* large model: stay within one segment */
+#define BENCH_WINDOW 1.0
+#else
+#define BENCH_CORPUS_MAX 1048576UL
+#define BENCH_WINDOW 0.25
+#endif
+
+#define BENCH_QUICK_WINDOW 0.005
+
+/* === Timing === */
+
+static double bench_now(void)
+{
+#if defined(__unix__) || defined(__APPLE__)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+#else
+    return (double)clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+/* Result sink so the compiler cannot drop a measured loop */
+static volatile size_t bench_sink;
+
+/* === Corpora === */
+
+typedef enum { CORPUS_TEXT, CORPUS_KV, CORPUS_FIXED, CORPUS_BAL, CORPUS_WORD, CORPUS_CSV } corpus_kind_t;
+
+static const char* const corpus_names[] = {"text", "kv", "fixed", "bal", "word", "csv"};
+
+/* Deterministic generator (same corpora every run) */
+static unsigned long bench_seed = 12345UL;
+
+static unsigned bench_rand(unsigned n)
+{
+    bench_seed = bench_seed * 1103515245UL + 12345UL;
+    return (unsigned)((bench_seed >> 16) % n);
+}
+
+/* Fill buf[0..len) with corpus text; last byte is '\n', the string is NUL-terminated */
+static void corpus_fill(char* buf, size_t len, corpus_kind_t kind)
+{
+    static const char* const keys[] = {"host", "port", "user", "timeout", "retries", "path"};
+    static const char* const months[] = {"JAN.", "FEB.", "MAR.", "SEP.", "OCT.", "DEC."};
+    size_t n = 0, i, k;
+    char line[96];
+
+    while (n + 1 < len) {
+        switch (kind) {
+        case CORPUS_TEXT:          /* identifiers, numbers, punctuation */
+            for (i = 0, k = 0; i < 8; i++) {
+                size_t w = 2 + bench_rand(8), j;
+                for (j = 0; j < w; j++) line[k++] = (char)((bench_rand(4) ? 'a' : 'A') + bench_rand(26));
+                if (bench_rand(3) == 0) k += (size_t)sprintf(line + k, "%u", bench_rand(1000));
+                line[k++] = bench_rand(5) ? ' ' : ',';
+            }
+            line[k++] = '\n';
+            break;
+        case CORPUS_KV:            /* key=value lines */
+            k = (size_t)sprintf(line, "%s=%u\n", keys[bench_rand(6)], bench_rand(65535));
+            break;
+        case CORPUS_FIXED:         /* historical fixed-width records */
+            k = (size_t)sprintf(line, "%04u %s %02u CHINA, CHIHLI\n",
+                                1000 + bench_rand(900), months[bench_rand(6)], 1 + bench_rand(28));
+            break;
+        case CORPUS_BAL:           /* nested balanced expressions */
+            for (i = 0, k = 0; i < 4; i++) {
+                size_t d = 1 + bench_rand(6), j;
+                for (j = 0; j < d; j++) line[k++] = '(';
+                line[k++] = (char)('a' + bench_rand(26));
+                for (j = 0; j < d; j++) line[k++] = ')';
+            }
+            line[k++] = '\n';
+            break;
+        case CORPUS_CSV:           /* comma-separated records, some fields quoted */
+            k = (size_t)sprintf(line, "%u,\"%s, %u\",%s,%u.%02u,\"SAID \"\"%s\"\"\"\n",
+                                1000 + bench_rand(9000), keys[bench_rand(6)], bench_rand(100),
+                                months[bench_rand(6)], bench_rand(1000), bench_rand(100), keys[bench_rand(6)]);
+            break;
+        default:                   /* one long identifier run per line */
+            for (k = 0; k < 80; k++) line[k] = (char)('a' + bench_rand(26));
+            line[k++] = '\n';
+            break;
+        }
+        if (n + k >= len) k = len - 1 - n;
+        memcpy(buf + n, line, k);
+        n += k;
+    }
+    if (len) {
+        buf[len - 1] = '\n';
+        buf[len] = '\0';
+    }
+}
+
+/* === Cases === */
+
+/* A case parses buf[0..len) once and returns the records (or matches) it found */
+typedef size_t (*bench_fn)(cstr_t* buf, size_t len);
+
+static size_t bench_span(cstr_t* buf, size_t len)
+{
+    sno_subject_t s = {0};
+    size_t n = 0;
+    sno_bind_n(&s, buf, len);
+    while (sno_len(&s, 1)) n += sno_span(&s, SNO_LETTERS);
+    return n;
+}
+
+static size_t bench_span_cset(cstr_t* buf, size_t len)
+{
+    sno_subject_t s = {0};
+    size_t n = 0;
+    sno_bind_n(&s, buf, len);
+    while (sno_len(&s, 1)) n += sno_span_cset(&s, &SNO_CSET_LETTERS);
+    return n;
+}
+
+static size_t bench_break_nl(cstr_t* buf, size_t len)
+{
+    sno_subject_t s = {0};
+    size_t n = 0;
+    sno_bind_n(&s, buf, len);
+    while (sno_break(&s, "\n") && sno_ch(&s, '\n')) n++;
+    return n;
+}
+
+static size_t bench_break_set(cstr_t* buf, size_t len)
+{
+    sno_subject_t s = {0};
+    size_t n = 0;
+    sno_bind_n(&s, buf, len);
+    while (sno_break(&s, ",;\n") && sno_len(&s, 1)) n++;
+    return n;
+}
+
+static size_t bench_any(cstr_t* buf, size_t len)
+{
+    sno_subject_t s = {0};
+    size_t n = 0;
+    sno_bind_n(&s, buf, len);
+    while (sno_any(&s, SNO_ALNUM) || sno_len(&s, 1)) n++;
+    return n;
+}
+
+static size_t bench_find_lit(cstr_t* buf, size_t len)
+{
+    sno_subject_t s = {0};
+    size_t n = 0;
+    sno_bind_n(&s, buf, len);
+    while (sno_find_lit(&s, "timeout") && sno_len(&s, 7)) n++;
+    return n;
+}
+
+/* README 2.4.1: identifier = letter followed by alphanumerics */
+static size_t bench_identifiers(cstr_t* buf, size_t len)
+{
+    sno_subject_t s = {0};
+    size_t n = 0;
+    sno_bind_n(&s, buf, len);
+    while (!sno_at_r(&s, 0)) {
+        if (sno_any_cset(&s, &SNO_CSET_LETTERS)) {
+            sno_span_cset(&s, &SNO_CSET_ALNUM_U);
+            n++;
+        }
+        else if (!sno_span_cset(&s, &SNO_CSET_DIGITS)) sno_len(&s, 1);
+    }
+    return n;
+}
+
+/* README 2.5.3: key=value per line */
+static size_t bench_key_value(cstr_t* buf, size_t len)
+{
+    sno_subject_t s = {0}, rec = {0};
+    sno_lines_t it;
+    size_t n = 0;
+    uint32_t v;
+    sno_bind_n(&s, buf, len);
+    sno_lines(&it, &s);
+    while (sno_lines_next(&it, &rec)) {
+        if (sno_span(&rec, SNO_ALNUM_U) && sno_ch(&rec, '=') && sno_rem(&rec) && sno_view_to_u32(rec.view, &v)) {
+            n++;
+            bench_sink += v;
+        }
+    }
+    return n;
+}
+
+/* README 2.3.1: fixed-width fields */
+static size_t bench_fixed_width(cstr_t* buf, size_t len)
+{
+    sno_subject_t s = {0}, rec = {0};
+    sno_lines_t it;
+    size_t n = 0;
+    sno_bind_n(&s, buf, len);
+    sno_lines(&it, &s);
+    while (sno_lines_next(&it, &rec)) {
+        if (sno_len(&rec, 4) && sno_tab(&rec, 5) && sno_len(&rec, 4) && sno_at(&rec, 9) &&
+            sno_tab(&rec, 10) && sno_len(&rec, 2)) n++;
+    }
+    return n;
+}
+
+/* README 2.7.1: balanced expressions */
+static size_t bench_bal(cstr_t* buf, size_t len)
+{
+    sno_subject_t s = {0};
+    size_t n = 0;
+    sno_bind_n(&s, buf, len);
+    while (!sno_at_r(&s, 0)) {
+        if (sno_bal(&s, '(', ')')) n++;
+        else sno_len(&s, 1);
+    }
+    return n;
+}
+
+/* Sum every number: span + convert (two passes) */
+static size_t bench_numbers_span(cstr_t* buf, size_t len)
+{
+    sno_subject_t s = {0};
+    size_t n = 0;
+    uint32_t v;
+    sno_bind_n(&s, buf, len);
+    while (sno_break_cset(&s, &SNO_CSET_DIGITS) && sno_span_cset(&s, &SNO_CSET_DIGITS)) {
+        if (sno_view_to_u32(s.view, &v)) {
+            bench_sink += v;
+            n++;
+        }
+    }
+    return n;
+}
+
+/* Sum every number: sno_uint (one pass) */
+static size_t bench_numbers_uint(cstr_t* buf, size_t len)
+{
+    sno_subject_t s = {0};
+    size_t n = 0;
+    uint32_t v;
+    sno_bind_n(&s, buf, len);
+    while (sno_break_cset(&s, &SNO_CSET_DIGITS) && sno_uint(&s, &v)) {
+        bench_sink += v;
+        n++;
+    }
+    return n;
+}
+
+/* Log filter: "timeout=<digits>" lines, compiled once */
+static const sno_pat_t* filter_pat(void)
+{
+    static sno_pat_t p;
+    static unsigned char code[64];
+    if (!p.done) {
+        sno_pat(&p, code, sizeof(code));
+        sno_pat_lit(&p, "timeout=");
+        sno_pat_span_cset(&p, &SNO_CSET_DIGITS);
+        sno_pat_done(&p);
+    }
+    return &p;
+}
+
+/* Filter one line at a time: sno_lines + sno_match */
+static size_t bench_filter_lines(cstr_t* buf, size_t len)
+{
+    sno_subject_t s = {0}, rec = {0};
+    sno_lines_t it;
+    const sno_pat_t* p = filter_pat();
+    size_t n = 0;
+    sno_bind_n(&s, buf, len);
+    sno_lines(&it, &s);
+    while (sno_lines_next(&it, &rec)) n += sno_match(&rec, p);
+    return n;
+}
+
+/* Same filter over batches of 256 lines (sno_match_batch_pat) */
+static size_t bench_filter_batch(cstr_t* buf, size_t len)
+{
+    static cstr_t* ptr[256];
+    static size_t lens[256];
+    unsigned char hits[256 / 8];
+    const sno_pat_t* p = filter_pat();
+    sno_batch_t b;
+    size_t n = 0, used = 0;
+    while (used < len) {
+        sno_batch(&b, ptr, lens, 256);
+        used += sno_batch_records(&b, buf + used, len - used, '\n');
+        n += sno_match_batch_pat(&b, p, hits);
+    }
+    return n;
+}
+
+/* CSV records split into field views (sno_split) */
+static size_t bench_csv_split(cstr_t* buf, size_t len)
+{
+    sno_subject_t s = {0}, rec = {0};
+    sno_lines_t it;
+    sno_cset_t comma;
+    sno_view_t f[8];
+    size_t n = 0;
+    sno_cset(&comma, ",");
+    sno_bind_n(&s, buf, len);
+    sno_lines(&it, &s);
+    while (sno_lines_next(&it, &rec)) {
+        size_t k = sno_split(&rec, &comma, '"', f, 8);
+        if (k) {
+            n++;
+            bench_sink += (size_t)(f[k > 8 ? 7 : k - 1].end - f[0].begin);
+        }
+    }
+    return n;
+}
+
+typedef struct {
+    const char* name;
+    bench_fn fn;
+    corpus_kind_t corpus;
+    bool lines;              /* also run over real-world files */
+} bench_case_t;
+
+static const bench_case_t cases[] = {
+    {"span",        bench_span,        CORPUS_WORD,  false},
+    {"span_cset",   bench_span_cset,   CORPUS_WORD,  false},
+    {"break_nl",    bench_break_nl,    CORPUS_TEXT,  true},
+    {"break_set",   bench_break_set,   CORPUS_TEXT,  true},
+    {"any",         bench_any,         CORPUS_TEXT,  false},
+    {"find_lit",    bench_find_lit,    CORPUS_KV,    true},
+    {"identifiers", bench_identifiers, CORPUS_TEXT,  true},
+    {"key_value",   bench_key_value,   CORPUS_KV,    true},
+    {"fixed_width", bench_fixed_width, CORPUS_FIXED, false},
+    {"bal",         bench_bal,         CORPUS_BAL,   false},
+    {"numbers_span", bench_numbers_span, CORPUS_FIXED, true},
+    {"numbers_uint", bench_numbers_uint, CORPUS_FIXED, true},
+    {"filter_lines", bench_filter_lines, CORPUS_KV,  true},
+    {"filter_batch", bench_filter_batch, CORPUS_KV,  true},
+    {"csv_split",   bench_csv_split,   CORPUS_CSV,   true},
+};
+
+/* === Driver === */
+
+/* Time one case over buf and print a result row */
+static void bench_run(const char* name, const char* corpus, bench_fn fn, cstr_t* buf,
+                      size_t len, double window, bool runs_mode)
+{
+    unsigned long iters = 1, i;
+    size_t records = 0;
+    double t0, dt;
+
+    for (;;) {
+        t0 = bench_now();
+        for (i = 0; i < iters; i++) records = fn(buf, len);
+        dt = bench_now() - t0;
+        if (dt >= window || iters >= 1UL << 30) break;
+        iters *= 2;
+    }
+    bench_sink += records;
+    if (runs_mode) {
+        printf("%-12s %-6s %8lu B %10lu runs in %.2f s  %lu rec/run\n",
+               name, corpus, (unsigned long)len, iters, dt, (unsigned long)records);
+    }
+    else {
+        printf("%-12s %-6s %8lu B %9.3f ns/B %12.0f rec/s\n", name, corpus, (unsigned long)len,
+               dt * 1e9 / ((double)iters * (double)len), (double)records * (double)iters / dt);
+    }
+}
+
+/* Read a whole file into malloc'd memory (NUL-terminated); NULL on failure */
+static char* bench_load(const char* path, size_t* len)
+{
+    FILE* f = fopen(path, "rb");
+    char* buf = NULL;
+    size_t cap = 0, n = 0, got;
+    if (!f) return NULL;
+    do {
+        if (n + 4096 + 1 > cap) {
+            char* grown;
+            cap = cap ? cap * 2 : 65536;
+            if (cap > BENCH_CORPUS_MAX + 4097) cap = BENCH_CORPUS_MAX + 4097;
+            if (n + 1 >= cap) break;                      /* truncate to corpus limit */
+            grown = (char*)realloc(buf, cap);
+            if (!grown) break;
+            buf = grown;
+        }
+        got = fread(buf + n, 1, cap - n - 1, f);
+        n += got;
+    } while (got);
+    fclose(f);
+    if (buf) buf[n] = '\0';
+    *len = n;
+    return buf;
+}
+
+int main(int argc, char** argv)
+{
+    static const unsigned long sizes[] = {1024UL, 65536UL, 1048576UL};
+    bool quick = false, runs_mode = false;
+    double window;
+    char* buf;
+    size_t c, z, nsizes;
+    int a;
+
+#if defined(__DOS__)
+    runs_mode = true;
+#endif
+    for (a = 1; a < argc && argv[a][0] == '-'; a++) {
+        if (strcmp(argv[a], "-q") == 0) quick = true;
+        else if (strcmp(argv[a], "-r") == 0) runs_mode = true;
+        else {
+            fprintf(stderr, "usage: %s [-q] [-r] [file ...]\n", argv[0]);
+            return 2;
+        }
+    }
+    window = quick ? BENCH_QUICK_WINDOW : BENCH_WINDOW;
+    nsizes = quick ? 1 : sizeof(sizes) / sizeof(sizes[0]);
+
+    buf = (char*)malloc(BENCH_CORPUS_MAX + 1);
+    if (!buf) return 1;
+
+    printf("%-12s %-6s %10s %s\n", "case", "corpus", "size", runs_mode ? "runs" : "throughput");
+    for (z = 0; z < nsizes && sizes[z] <= BENCH_CORPUS_MAX; z++) {
+        for (c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+            corpus_fill(buf, (size_t)sizes[z], cases[c].corpus);
+            bench_run(cases[c].name, corpus_names[cases[c].corpus], cases[c].fn, buf,
+                      (size_t)sizes[z], window, runs_mode);
+        }
+    }
+    free(buf);
+
+    for (; a < argc; a++) {                               /* real-world corpora */
+        size_t len = 0;
+        char* text = bench_load(argv[a], &len);
+        if (!text || !len) {
+            fprintf(stderr, "%s: cannot read\n", argv[a]);
+            free(text);
+            continue;
+        }
+        for (c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+            if (cases[c].lines) bench_run(cases[c].name, "file", cases[c].fn, text, len, window, runs_mode);
+        }
+        free(text);
+    }
+    return 0;
+}
@@ -0,0 +1,370 @@
+/* sno_scale.c — Scaling regression: time per byte must stay flat as input grows */
+
+#if defined(__unix__) || defined(__APPLE__)
+#define _POSIX_C_SOURCE 199309L   /* clock_gettime */
+#endif
+
+#include "sno.h"
+#include "sno_constants.h"
+#include "sno_lines.h"
+#include "sno_num.h"
+#include "sno_split.h"
+#include "sno_str.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * @file sno_scale.c
+ * @brief Checks the O(n) worst-case claim: every primitive and README grammar on 1 KB to 100 MB
+ *
+ * Usage: sno_scale [-q] [-m MB]
+ *   -q     quick: up to 4 MB, short timing windows (ctest)
+ *   -m MB  largest input in megabytes (default 64; -m 100 for the full claim)
+ *
+ * Each case runs on inputs growing 16x per step from 1 KB, most of them
+ * adversarial: all members for a span, no members for a break, a near miss
+ * at every position for a literal search, nesting that never closes. A
+ * linear case keeps its ns/byte within cache effects. Two checks fail the
+ * run (exit 1): a step more than SCALE_GROWTH times slower per byte (a
+ * quadratic case gains 16x per step), and a least-squares slope of
+ * log(ns/B) against log(bytes) above SCALE_SLOPE over the whole range. The
+ * slope catches mild superlinearity such as O(n^1.5), which gains only 4x
+ * per step but several hundredfold from 1 KB to 64 MB. The best of three
+ * windows is kept to shed timer noise.
+ */
+
+#define SCALE_FIRST 1024UL
+#define SCALE_STEP 16UL
+#define SCALE_GROWTH 6.0           /* allowed ns/B ratio per 16x step (quadratic: 16) */
+#define SCALE_SLOPE 0.1            /* allowed d log(ns/B) / d log(bytes): time up to O(n^1.1) */
+#define SCALE_WINDOW 0.05
+#define SCALE_QUICK_WINDOW 0.004
+#define SCALE_QUICK_MAX (4UL << 20)
+#define SCALE_DEFAULT_MB 64UL
+
+/* === Timing === */
+
+static double scale_now(void)
+{
+#if defined(__unix__) || defined(__APPLE__)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+#else
+    return (double)clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+/* Result sink so the compiler cannot drop a measured loop */
+static volatile size_t scale_sink;
+
+/* === Inputs === */
+
+/* Fill buf[0..len) (NUL-terminated) */
+typedef void (*scale_fill_fn)(char* buf, size_t len);
+
+/* Repeat pat over buf[0..len) */
+static void fill_repeat(char* buf, size_t len, const char* pat)
+{
+    size_t m = strlen(pat), i;
+    for (i = 0; i < len; i++) buf[i] = pat[i % m];
+    buf[len] = '\0';
+}
+
+static void fill_a(char* buf, size_t len) { fill_repeat(buf, len, "a"); }
+static void fill_newlines(char* buf, size_t len) { fill_repeat(buf, len, "\n"); }
+static void fill_digits(char* buf, size_t len) { fill_repeat(buf, len, "9"); }
+static void fill_quotes(char* buf, size_t len) { fill_repeat(buf, len, "\"\""); }
+static void fill_commas(char* buf, size_t len) { fill_repeat(buf, len, ","); }
+static void fill_kv(char* buf, size_t len) { fill_repeat(buf, len, "timeout=30\n"); }
+
+/* Deepest nesting: n/2 opens then n/2 closes */
+static void fill_nested(char* buf, size_t len)
+{
+    memset(buf, '(', len / 2);
+    memset(buf + len / 2, ')', len - len / 2);
+    buf[len] = '\0';
+}
+
+/* Opens that never close: sno_bal reads everything before failing */
+static void fill_unclosed(char* buf, size_t len) { fill_repeat(buf, len, "("); }
+
+/* An open bracket, then a quote that never closes */
+static void fill_open_quote(char* buf, size_t len)
+{
+    fill_repeat(buf, len, "a");
+    if (len > 1) {
+        buf[0] = '(';
+        buf[1] = '"';
+    }
+}
+
+/* Depth-32 groups, the last one left open: parens fails at the final byte */
+static void fill_groups(char* buf, size_t len)
+{
+    size_t i;
+    for (i = 0; i < len; i++) buf[i] = (i % 64) < 32 ? '(' : ')';
+    if (len) buf[len - 1] = '(';
+    buf[len] = '\0';
+}
+
+/* === Cases === */
+
+/* A case parses buf[0..len) once and returns a count */
+typedef size_t (*scale_fn)(cstr_t* buf, size_t len);
+
+static size_t scale_span(cstr_t* buf, size_t len)
+{
+    sno_subject_t s = {0};
+    sno_bind_n(&s, buf, len);
+    return sno_span(&s, SNO_LETTERS);
+}
+
+static size_t scale_span_cset(cstr_t* buf, size_t len)
+{
+    sno_subject_t s = {0};
+    sno_bind_n(&s, buf, len);
+    return sno_span_cset(&s, &SNO_CSET_LETTERS);
+}
+
+static size_t scale_break(cstr_t* buf, size_t len)
+{
+    sno_subject_t s = {0};
+    sno_bind_n(&s, buf, len);
+    return sno_break(&s, ",;=\n") && sno_at_r(&s, 0);
+}
+
+static size_t scale_break_cset(cstr_t* buf, size_t len)
+{
+    sno_subject_t s = {0};
+    sno_bind_n(&s, buf, len);
+    return sno_break_cset(&s, &SNO_CSET_DIGITS) && sno_at_r(&s, 0);
+}
+
+/* One primitive call per byte */
+static size_t scale_any(cstr_t* buf, size_t len)
+{
+    sno_subject_t s = {0};
+    size_t n = 0;
+    sno_bind_n(&s, buf, len);
+    while (sno_any(&s, "abc")) n++;
+    return n;
+}
+
+/* "aaa…" against "aaab": a near miss at every position */
+static size_t scale_find_lit(cstr_t* buf, size_t len)
+{
+    sno_subject_t s = {0};
+    sno_bind_n(&s, buf, len);
+    return sno_find_lit(&s, "aaab");
+}
+
+static size_t scale_rfind_lit(cstr_t* buf, size_t len)
+{
+    sno_subject_t s = {0};
+    sno_bind_n(&s, buf, len);
+    return sno_rfind_lit(&s, "baaa");
+}
+
+static size_t scale_rspan(cstr_t* buf, size_t len)
+{
+    sno_subject_t s = {0};
+    sno_bind_n(&s, buf, len);
+    return sno_rspan(&s, SNO_LETTERS);
+}
+
+static size_t scale_bal(cstr_t* buf, size_t len)
+{
+    sno_subject_t s = {0};
+    sno_bind_n(&s, buf, len);
+    return sno_bal(&s, '(', ')');
+}
+
+static size_t scale_bal_set_quoted(cstr_t* buf, size_t len)
+{
+    sno_subject_t s = {0};
+    sno_bind_n(&s, buf, len);
+    return sno_bal_set_quoted(&s, "([{", ")]}", "\"'");
+}
+
+/* README 1.1: recursive grammar */
+static bool parens(sno_subject_t* s)
+{
+    while (sno_ch(s, '(')) {
+        if (!parens(s) || !sno_ch(s, ')')) return false;
+    }
+    return true;
+}
+
+static size_t scale_parens(cstr_t* buf, size_t len)
+{
+    sno_subject_t s = {0};
+    size_t n = 0;
+    sno_bind_n(&s, buf, len);
+    while (parens(&s) && sno_ch(&s, ')')) n++;    /* resync after a stray close */
+    return n + (size_t)(s.view.end - s.str.begin);
+}
+
+/* README 2.5.3: key=value per line */
+static size_t scale_key_value(cstr_t* buf, size_t len)
+{
+    sno_subject_t s = {0}, rec = {0};
+    sno_lines_t it;
+    size_t n = 0;
+    uint32_t v;
+    sno_bind_n(&s, buf, len);
+    sno_lines(&it, &s);
+    while (sno_lines_next(&it, &rec)) {
+        if (sno_span(&rec, SNO_ALNUM_U) && sno_ch(&rec, '=') && sno_rem(&rec) && sno_view_to_u32(rec.view, &v)) n++;
+    }
+    return n;
+}
+
+static size_t scale_lines(cstr_t* buf, size_t len)
+{
+    sno_subject_t s = {0}, rec = {0};
+    sno_lines_t it;
+    size_t n = 0;
+    sno_bind_n(&s, buf, len);
+    sno_lines(&it, &s);
+    while (sno_lines_next(&it, &rec)) n++;
+    return n;
+}
+
+/* Numbers back to back: each run overflows and is skipped a byte at a time */
+static size_t scale_uint(cstr_t* buf, size_t len)
+{
+    sno_subject_t s = {0};
+    size_t n = 0;
+    uint32_t v;
+    sno_bind_n(&s, buf, len);
+    while (sno_uint(&s, &v) || sno_len(&s, 1)) n++;
+    return n;
+}
+
+static size_t scale_split(cstr_t* buf, size_t len)
+{
+    sno_subject_t s = {0};
+    sno_cset_t comma;
+    sno_view_t f[8];
+    sno_cset(&comma, ",");
+    sno_bind_n(&s, buf, len);
+    return sno_split(&s, &comma, '"', f, 8);
+}
+
+typedef struct {
+    const char* name;
+    scale_fn fn;
+    scale_fill_fn fill;
+    const char* input;
+} scale_case_t;
+
+static const scale_case_t cases[] = {
+    {"span",       scale_span,       fill_a,        "all members"},
+    {"span_cset",  scale_span_cset,  fill_a,        "all members"},
+    {"break",      scale_break,      fill_a,        "no members"},
+    {"break_cset", scale_break_cset, fill_a,        "no members"},
+    {"any",        scale_any,        fill_a,        "call per byte"},
+    {"find_lit",   scale_find_lit,   fill_a,        "near miss everywhere"},
+    {"rfind_lit",  scale_rfind_lit,  fill_a,        "near miss everywhere"},
+    {"rspan",      scale_rspan,      fill_a,        "all members"},
+    {"bal",        scale_bal,        fill_nested,   "nesting n/2"},
+    {"bal",        scale_bal,        fill_unclosed, "never closes"},
+    {"bal_quoted", scale_bal_set_quoted, fill_open_quote, "quote never closes"},
+    {"parens",     scale_parens,     fill_groups,   "last group open"},
+    {"key_value",  scale_key_value,  fill_kv,       "README lines"},
+    {"key_value",  scale_key_value,  fill_a,        "one line, no '='"},
+    {"lines",      scale_lines,      fill_newlines, "empty records"},
+    {"uint",       scale_uint,       fill_digits,   "overflowing run"},
+    {"split",      scale_split,      fill_commas,   "all delimiters"},
+    {"split",      scale_split,      fill_quotes,   "all quotes"},
+};
+
+/* Best ns/byte of three windows */
+static double scale_time(scale_fn fn, cstr_t* buf, size_t len, double window)
+{
+    double best = 0.0;
+    int r;
+    for (r = 0; r < 3; r++) {
+        unsigned long iters = 1, i;
+        double t0, dt, nsb;
+        for (;;) {
+            t0 = scale_now();
+            for (i = 0; i < iters; i++) scale_sink += fn(buf, len);
+            dt = scale_now() - t0;
+            if (dt >= window || iters >= 1UL << 30) break;
+            iters *= 2;
+        }
+        nsb = dt * 1e9 / ((double)iters * (double)len);
+        if (r == 0 || nsb < best) best = nsb;
+    }
+    return best;
+}
+
+int main(int argc, char** argv)
+{
+    unsigned long max = SCALE_DEFAULT_MB << 20;
+    bool quick = false;
+    double window;
+    char* buf;
+    size_t c;
+    int a, failures = 0;
+
+    for (a = 1; a < argc; a++) {
+        if (strcmp(argv[a], "-q") == 0) quick = true;
+        else if (strcmp(argv[a], "-m") == 0 && a + 1 < argc) max = strtoul(argv[++a], NULL, 10) << 20;
+        else {
+            fprintf(stderr, "usage: %s [-q] [-m MB]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (quick && max > SCALE_QUICK_MAX) max = SCALE_QUICK_MAX;
+    if (max < SCALE_FIRST) max = SCALE_FIRST;
+    window = quick ? SCALE_QUICK_WINDOW : SCALE_WINDOW;
+
+    buf = (char*)malloc(max + 1);
+    if (!buf) {
+        fprintf(stderr, "sno_scale: cannot allocate %lu bytes\n", max + 1);
+        return 1;
+    }
+
+    printf("%-10s %-20s %10s %9s %7s\n", "case", "input", "size", "ns/B", "growth");
+    for (c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+        unsigned long len = SCALE_FIRST, prev = 0;
+        double prev_nsb = 0.0, sx = 0.0, sy = 0.0, sxx = 0.0, sxy = 0.0, slope;
+        int pts = 0;
+        for (;;) {
+            double nsb, growth, limit;
+            cases[c].fill(buf, (size_t)len);
+            nsb = scale_time(cases[c].fn, buf, (size_t)len, window);
+            growth = prev ? nsb / prev_nsb : 1.0;
+            /* a short last step (e.g. 64 MB -> 100 MB) allows at least cache slack */
+            limit = prev ? SCALE_GROWTH * (double)len / ((double)prev * SCALE_STEP) : 0.0;
+            if (limit < SCALE_GROWTH / 2) limit = SCALE_GROWTH / 2;
+            printf("%-10s %-20s %10lu %9.3f %6.2fx%s\n", cases[c].name, cases[c].input, len, nsb, growth,
+                   prev && growth > limit ? "  FAIL: superlinear" : "");
+            if (prev && growth > limit) failures++;
+            sx += log((double)len);                  /* log-log fit over every step */
+            sy += log(nsb);
+            sxx += log((double)len) * log((double)len);
+            sxy += log((double)len) * log(nsb);
+            pts++;
+            if (len == max) break;
+            prev = len;
+            prev_nsb = nsb;
+            len = len * SCALE_STEP > max ? max : len * SCALE_STEP;
+        }
+        if (pts >= 3) {
+            slope = (pts * sxy - sx * sy) / (pts * sxx - sx * sx);
+            printf("%-10s %-20s %10s %+9.3f%s\n", cases[c].name, cases[c].input, "slope", slope,
+                   slope > SCALE_SLOPE ? "  FAIL: superlinear" : "");
+            if (slope > SCALE_SLOPE) failures++;
+        }
+    }
+    free(buf);
+    if (failures) fprintf(stderr, "sno_scale: %d step(s) or slope(s) grew superlinearly\n", failures);
+    return failures ? 1 : 0;
+}
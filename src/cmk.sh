@@ -4,4 +4,5 @@ echo "Running CMAKE for OW2..."
 # clean cache
 rm -rf ../bin/CMakeCache.txt ../bin/CMakeFiles/
 
-cmake -G "Watcom WMake" -D CMAKE_SYSTEM_NAME=DOS -D CMAKE_SYSTEM_PROCESSOR=I86 -S. -B ../bin
+# optional build type: ./cmk.sh Release (-ox -ot) or ./cmk.sh MinSizeRel (-ox -os)
+cmake -G "Watcom WMake" -D CMAKE_SYSTEM_NAME=DOS -D CMAKE_SYSTEM_PROCESSOR=I86 ${1:+-D CMAKE_BUILD_TYPE=$1} -S. -B ../bin
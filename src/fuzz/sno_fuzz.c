@@ -0,0 +1,347 @@
+/* sno_fuzz.c — Primitives against byte-at-a-time references (libFuzzer, AFL, random) */
+
+#include "sno.h"
+#include "sno_num.h"
+#include "sno_split.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @file sno_fuzz.c
+ * @brief Checks every fast path (SIMD, memchr, Horspool, csets) against the scalar definition
+ *
+ * One input drives every primitive: the first bytes choose a set, a literal,
+ * a quote and a start offset, and the rest is the subject. Each primitive runs
+ * from that offset and must agree with a naive reference. The view must match
+ * on success, and the cursor must be unchanged on failure. A mismatch prints
+ * the primitive and aborts, so fuzzers record the input.
+ *
+ * The subject is copied into an exact-size heap block with no NUL after it,
+ * so an ASan build also catches any read past str.end.
+ *
+ * Build with -DSNO_FUZZ_LIBFUZZER and -fsanitize=fuzzer to get the libFuzzer
+ * entry point alone. Otherwise main() drives the same function:
+ *   sno_fuzz              one input from stdin (AFL: afl-fuzz -- sno_fuzz)
+ *   sno_fuzz file ...     replay saved inputs (AFL: sno_fuzz @@)
+ *   sno_fuzz -n count     count pseudo-random inputs (ctest smoke run)
+ */
+
+/* === Input Layout === */
+
+#define FUZZ_SET_MAX 8
+#define FUZZ_LIT_MAX 8
+
+typedef struct {
+    char set[FUZZ_SET_MAX + 1];  /* set string, no '\0' members */
+    char lit[FUZZ_LIT_MAX + 1];  /* literal, no '\0' */
+    char quote;                  /* '"' or '\0' */
+    sno_cset_t cs;               /* same members as set */
+    cstr_t* b;                   /* subject */
+    cstr_t* e;
+    size_t at;                   /* start offset, ≤ e - b */
+} fuzz_case_t;
+
+static bool fuzz_has(const fuzz_case_t* c, char ch)
+{
+    return ch != '\0' && strchr(c->set, ch) != NULL;
+}
+
+static void fuzz_fail(const char* prim, const fuzz_case_t* c)
+{
+    fprintf(stderr, "sno_fuzz: %s disagrees with reference (len %u, at %u, set \"%s\", lit \"%s\")\n",
+            prim, (unsigned)(c->e - c->b), (unsigned)c->at, c->set, c->lit);
+    abort();
+}
+
+/* Subject bound to the case, cursor at the start offset */
+static void fuzz_subject(sno_subject_t* s, const fuzz_case_t* c)
+{
+    sno_bind_n(s, c->b, (size_t)(c->e - c->b));
+    s->view.begin = s->view.end = c->b + c->at;
+}
+
+/* Compare one outcome: ok and view on success, unmoved cursor on failure */
+static void fuzz_check(const char* prim, const fuzz_case_t* c, const sno_subject_t* s, bool ok,
+                       bool want, cstr_t* vb, cstr_t* ve)
+{
+    if (ok != want) fuzz_fail(prim, c);
+    if (ok && (s->view.begin != vb || s->view.end != ve)) fuzz_fail(prim, c);
+    if (!ok && s->view.end != c->b + c->at) fuzz_fail(prim, c);
+}
+
+/* === References === */
+
+static cstr_t* ref_scan(const fuzz_case_t* c, cstr_t* p, bool span)
+{
+    while (p < c->e && fuzz_has(c, *p) == span) p++;
+    return p;
+}
+
+static cstr_t* ref_rscan(const fuzz_case_t* c, cstr_t* b, bool span)
+{
+    cstr_t* p = c->e;
+    while (p > b && fuzz_has(c, p[-1]) == span) p--;
+    return p;
+}
+
+static bool ref_eq(cstr_t* p, const char* lit, size_t m, bool ci)
+{
+    size_t i;
+    for (i = 0; i < m; i++) {
+        unsigned char a = (unsigned char)p[i], b = (unsigned char)lit[i];
+        if (ci && a >= 'A' && a <= 'Z') a |= 0x20;
+        if (ci && b >= 'A' && b <= 'Z') b |= 0x20;
+        if (a != b) return false;
+    }
+    return true;
+}
+
+/* === Checks === */
+
+static void fuzz_scans(const fuzz_case_t* c)
+{
+    sno_subject_t s = {0};
+    cstr_t* pos = c->b + c->at;
+    cstr_t* p;
+    bool one = pos < c->e && fuzz_has(c, *pos);
+    bool ok;
+
+    fuzz_subject(&s, c);
+    ok = sno_any(&s, c->set);
+    fuzz_check("sno_any", c, &s, ok, one, pos, pos + 1);
+    fuzz_subject(&s, c);
+    ok = sno_any_cset(&s, &c->cs);
+    fuzz_check("sno_any_cset", c, &s, ok, one, pos, pos + 1);
+    fuzz_subject(&s, c);
+    ok = sno_notany(&s, c->set);
+    fuzz_check("sno_notany", c, &s, ok, pos < c->e && !one, pos, pos + 1);
+    fuzz_subject(&s, c);
+    ok = sno_notany_cset(&s, &c->cs);
+    fuzz_check("sno_notany_cset", c, &s, ok, pos < c->e && !one, pos, pos + 1);
+
+    p = ref_scan(c, pos, true);
+    fuzz_subject(&s, c);
+    ok = sno_span(&s, c->set);
+    fuzz_check("sno_span", c, &s, ok, p > pos, pos, p);
+    fuzz_subject(&s, c);
+    ok = sno_span_cset(&s, &c->cs);
+    fuzz_check("sno_span_cset", c, &s, ok, p > pos, pos, p);
+
+    p = ref_scan(c, pos, false);
+    fuzz_subject(&s, c);
+    ok = sno_break(&s, c->set);
+    fuzz_check("sno_break", c, &s, ok, true, pos, p);
+    fuzz_subject(&s, c);
+    ok = sno_break_cset(&s, &c->cs);
+    fuzz_check("sno_break_cset", c, &s, ok, true, pos, p);
+
+    p = ref_rscan(c, pos, true);
+    fuzz_subject(&s, c);
+    ok = sno_rspan(&s, c->set);
+    fuzz_check("sno_rspan", c, &s, ok, p < c->e, p, c->e);
+    fuzz_subject(&s, c);
+    ok = sno_rspan_cset(&s, &c->cs);
+    fuzz_check("sno_rspan_cset", c, &s, ok, p < c->e, p, c->e);
+
+    p = ref_rscan(c, pos, false);
+    fuzz_subject(&s, c);
+    ok = sno_rbreak(&s, c->set);
+    fuzz_check("sno_rbreak", c, &s, ok, true, p, c->e);
+    fuzz_subject(&s, c);
+    ok = sno_rbreak_cset(&s, &c->cs);
+    fuzz_check("sno_rbreak_cset", c, &s, ok, true, p, c->e);
+}
+
+static void fuzz_literals(const fuzz_case_t* c)
+{
+    sno_subject_t s = {0};
+    cstr_t* pos = c->b + c->at;
+    cstr_t* p;
+    cstr_t* hit = NULL;
+    size_t m = strlen(c->lit);
+    bool fits = m <= (size_t)(c->e - pos);
+    bool ok;
+
+    fuzz_subject(&s, c);
+    ok = sno_lit(&s, c->lit);
+    fuzz_check("sno_lit", c, &s, ok, fits && ref_eq(pos, c->lit, m, false), pos, pos + m);
+    fuzz_subject(&s, c);
+    ok = sno_lit_ci(&s, c->lit);
+    fuzz_check("sno_lit_ci", c, &s, ok, fits && ref_eq(pos, c->lit, m, true), pos, pos + m);
+
+    for (p = pos; fits && p + m <= c->e; p++) {
+        if (ref_eq(p, c->lit, m, false)) {
+            hit = p;
+            break;
+        }
+    }
+    fuzz_subject(&s, c);
+    ok = sno_find_lit(&s, c->lit);
+    fuzz_check("sno_find_lit", c, &s, ok, hit != NULL, pos, hit);
+
+    hit = NULL;
+    for (p = c->e - m; fits && p >= pos; p--) {
+        if (ref_eq(p, c->lit, m, false)) {
+            hit = p;
+            break;
+        }
+        if (p == pos) break;
+    }
+    fuzz_subject(&s, c);
+    ok = sno_rfind_lit(&s, c->lit);
+    fuzz_check("sno_rfind_lit", c, &s, ok, hit != NULL, hit, hit + m);
+}
+
+static void fuzz_structure(const fuzz_case_t* c)
+{
+    static sno_view_t got[64], want[64];
+    sno_subject_t s = {0};
+    cstr_t* pos = c->b + c->at;
+    cstr_t* p;
+    cstr_t* start = pos;
+    size_t depth = 0, n = 0, k;
+    bool inq = false, ok;
+    uint64_t v = 0;
+    uint32_t u;
+
+    /* sno_bal: depth counter */
+    for (p = pos; p < c->e; p++) {
+        if (p == pos && *p != '(') break;
+        if (*p == '(') depth++;
+        else if (*p == ')' && --depth == 0) break;
+    }
+    fuzz_subject(&s, c);
+    ok = sno_bal(&s, '(', ')');
+    fuzz_check("sno_bal", c, &s, ok, p < c->e && p > pos, pos, p + 1);
+
+    /* sno_uint: greedy digits within 32 bits */
+    for (p = pos; p < c->e && *p >= '0' && *p <= '9' && v <= UINT32_MAX; p++) v = v * 10 + (uint64_t)(*p - '0');
+    fuzz_subject(&s, c);
+    ok = sno_uint(&s, &u);
+    fuzz_check("sno_uint", c, &s, ok, p > pos && v <= UINT32_MAX, pos, p);
+    if (ok && u != (uint32_t)v) fuzz_fail("sno_uint value", c);
+
+    /* sno_split: the set as delimiters */
+    for (p = pos; p <= c->e; p++) {
+        if (p < c->e && c->quote && *p == c->quote) {
+            inq = !inq;
+            continue;
+        }
+        if (p < c->e && (inq || !fuzz_has(c, *p))) continue;
+        if (n < 64) {
+            bool q = c->quote && p - start >= 2 && start[0] == c->quote && p[-1] == c->quote;
+            want[n].begin = start + q;
+            want[n].end = p - q;
+        }
+        n++;
+        start = p + 1;
+    }
+    if (inq) n = 0;
+    fuzz_subject(&s, c);
+    k = sno_split(&s, &c->cs, c->quote, got, 64);
+    if (k != n) fuzz_fail("sno_split", c);
+    for (k = 0; k < n && k < 64; k++) {
+        if (got[k].begin != want[k].begin || got[k].end != want[k].end) fuzz_fail("sno_split field", c);
+    }
+    if (n ? s.view.end != c->e : s.view.end != pos) fuzz_fail("sno_split cursor", c);
+}
+
+/* === Entry Points === */
+
+int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size);
+
+int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size)
+{
+    fuzz_case_t c;
+    char* copy;
+    size_t i, n, len;
+    if (size < 1) return 0;
+    memset(&c, 0, sizeof c);
+    n = (size_t)(data[0] & 7);                   /* set length */
+    len = (size_t)((data[0] >> 3) & 7);          /* literal length */
+    c.quote = (data[0] & 0x40) ? '"' : '\0';
+    data++;
+    size--;
+    for (i = 0; i < n && size; i++, data++, size--) {
+        if (*data) c.set[strlen(c.set)] = (char)*data;
+    }
+    for (i = 0; i < len && size; i++, data++, size--) {
+        if (*data) c.lit[strlen(c.lit)] = (char)*data;
+    }
+    if (size) {
+        c.at = *data++;
+        size--;
+    }
+    if (c.at > size) c.at = size;
+    copy = (char*)malloc(size ? size : 1);
+    if (!copy) return 0;
+    if (size) memcpy(copy, data, size);
+    c.b = copy;
+    c.e = copy + size;
+    sno_cset(&c.cs, c.set);
+    fuzz_scans(&c);
+    fuzz_literals(&c);
+    fuzz_structure(&c);
+    free(copy);
+    return 0;
+}
+
+#ifndef SNO_FUZZ_LIBFUZZER
+
+#define FUZZ_INPUT_MAX (1UL << 20)
+
+/* One input from f */
+static void fuzz_file(FILE* f)
+{
+    static uint8_t buf[FUZZ_INPUT_MAX];
+    size_t n = fread(buf, 1, sizeof buf, f);
+    LLVMFuzzerTestOneInput(buf, n);
+}
+
+/* count random inputs over an alphabet dense in members, quotes, parens and digits */
+static void fuzz_random(unsigned long count)
+{
+    static const char alpha[] = "aAbB,;\"()09x \t\0\x80\xff";
+    static uint8_t buf[600];
+    unsigned long seed = 1UL, r;
+    size_t i, n;
+    while (count--) {
+        seed = seed * 1103515245UL + 12345UL;
+        r = seed >> 8;
+        n = 11 + (size_t)(r % (sizeof buf - 11));
+        buf[0] = (uint8_t)(seed >> 16);
+        for (i = 1; i < n; i++) {
+            seed = seed * 1103515245UL + 12345UL;
+            buf[i] = (uint8_t)alpha[(seed >> 16) % (sizeof alpha - 1)];
+        }
+        buf[1 + (buf[0] & 7) + ((buf[0] >> 3) & 7)] = (uint8_t)((seed >> 20) & 31);   /* start offset */
+        LLVMFuzzerTestOneInput(buf, n);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    int i;
+    if (argc == 3 && strcmp(argv[1], "-n") == 0) {
+        fuzz_random(strtoul(argv[2], NULL, 10));
+        return 0;
+    }
+    if (argc == 1) {
+        fuzz_file(stdin);
+        return 0;
+    }
+    for (i = 1; i < argc; i++) {
+        FILE* f = fopen(argv[i], "rb");
+        if (!f) {
+            fprintf(stderr, "sno_fuzz: cannot open %s\n", argv[i]);
+            return 1;
+        }
+        fuzz_file(f);
+        fclose(f);
+    }
+    return 0;
+}
+
+#endif
@@ -1,8 +1,36 @@
 #include <stdio.h>
 #include "SNO/sno_test.h"
+#include "SNO/sno_str_test.h"
+#include "SNO/sno_stream_test.h"
+#include "SNO/sno_lines_test.h"
+#include "SNO/sno_parallel_test.h"
+#include "SNO/sno_pat_test.h"
+#include "SNO/sno_patset_test.h"
+#include "SNO/sno_memo_test.h"
+#include "SNO/sno_arena_test.h"
+#include "SNO/sno_xlat_test.h"
+#include "SNO/sno_stats_test.h"
+#include "SNO/sno_trace_test.h"
+#include "SNO/sno_batch_test.h"
+#include "SNO/sno_num_test.h"
+#include "SNO/sno_split_test.h"
 
 int main() {
     printf("testing... ");
     sno_test();
+    sno_str_test();
+    sno_stream_test();
+    sno_lines_test();
+    sno_parallel_test();
+    sno_pat_test();
+    sno_patset_test();
+    sno_memo_test();
+    sno_arena_test();
+    sno_xlat_test();
+    sno_stats_test();
+    sno_trace_test();
+    sno_batch_test();
+    sno_num_test();
+    sno_split_test();
     printf("passed!\n");
 }